@@ -1094,6 +1094,13 @@ namespace storm {
             } else {
                 verifyWithAbstractionRefinementEngine<DdType, ValueType>(model, input, mpi);
             }
+            
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                auto symbolicModel = std::dynamic_pointer_cast<storm::models::symbolic::Model<DdType, ValueType>>(model);
+                if (symbolicModel) {
+                    STORM_PRINT("DD manager statistics:" << std::endl << symbolicModel->getManager().getStatistics() << std::endl);
+                }
+            }
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
@@ -1,10 +1,12 @@
 #include "ExplicitDFTModelBuilder.h"
 
 #include <map>
+#include <type_traits>
 
 #include <storm/exceptions/IllegalArgumentException.h>
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/utility/bitoperations.h"
@@ -264,7 +266,7 @@ namespace storm {
             // Push skipped states to explore queue
             // TODO: remove
             for (auto const& skippedState : skippedStates) {
-                statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
+                statesNotExplored[skippedState.second.second->getId()] = skippedState.second;
                 explorationQueue.push(skippedState.second.second);
             }
 
@@ -294,7 +296,7 @@ namespace storm {
             matrixBuilder.mappingOffset = nrStates;
             STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
             StateType skippedIndex = nrExpandedStates;
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+            std::map<StateType, std::pair<uint64_t, ExplorationHeuristicPointer>> skippedStatesNew;
             for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
                 StateType index = matrixBuilder.getRemapping(id);
                 auto itFind = skippedStates.find(index);
@@ -341,7 +343,7 @@ namespace storm {
                             auto itFind = skippedStates.find(itEntry->getColumn());
                             if (itFind != skippedStates.end()) {
                                 // Set id for skipped states as we remap it later
-                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                                matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.second->getId(), itEntry->getValue());
                             } else {
                                 // Set newly remapped index for expanded states
                                 matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -362,100 +364,149 @@ namespace storm {
         void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double approximationThreshold) {
             size_t nrExpandedStates = 0;
             size_t nrSkippedStates = 0;
+            auto const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+            size_t batchSize = ftSettings.isParallelExplorationSet() ? ftSettings.getParallelExplorationBatchSize() : 1;
             storm::utility::ProgressMeasurement progress("explored states");
             progress.startNewMeasurement(0);
+            std::vector<ExpandedState> batch;
             // TODO: do not empty queue every time but break before
             while (!explorationQueue.empty()) {
-                // Get the first state in the queue
-                ExplorationHeuristicPointer currentExplorationHeuristic = explorationQueue.pop();
-                StateType currentId = currentExplorationHeuristic->getId();
-                auto itFind = statesNotExplored.find(currentId);
-                STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-                DFTStatePointer currentState = itFind->second.first;
-                STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-                STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
-                // Remove it from the list of not explored states
-                statesNotExplored.erase(itFind);
-                STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
-                STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
-
-                // Get concrete state if necessary
-                if (currentState->isPseudoState()) {
-                    // Create concrete state from pseudo state
-                    currentState->construct();
-                }
-                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
-                // Remember that the current row group was actually filled with the transitions of a different state
-                matrixBuilder.setRemapping(currentId);
-
-                matrixBuilder.newRowGroup();
-
-                // Try to explore the next state
-                generator.load(currentState);
-
-                //if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
-                if (approximationThreshold > 0.0 && currentExplorationHeuristic->isSkip(approximationThreshold)) {
-                    // Skip the current state
-                    ++nrSkippedStates;
-                    STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(currentState));
-                    setMarkovian(true);
-                    // Add transition to target state with temporary value 0
-                    // TODO: what to do when there is no unique target state?
-                    //STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
-                    matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
-                    // Remember skipped state
-                    skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
-                    matrixBuilder.finishRow();
+                // Get the first states in the queue
+                batch.clear();
+                while (batch.size() < batchSize && !explorationQueue.empty()) {
+                    ExpandedState expansion;
+                    expansion.heuristic = explorationQueue.pop();
+                    expansion.id = expansion.heuristic->getId();
+                    auto itFind = statesNotExplored.find(expansion.id);
+                    STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << expansion.id << " not found");
+                    STORM_LOG_ASSERT(expansion.heuristic == itFind->second.second, "Exploration heuristics do not match");
+                    expansion.status = stateStorage.stateToId.getBucketAndValue(itFind->second.first).first;
+                    // Remove it from the list of not explored states
+                    statesNotExplored.erase(itFind);
+                    //if (approximationThreshold > 0.0 && nrExpandedStates > approximationThreshold && !currentExplorationHeuristic->isExpand()) {
+                    expansion.skip = approximationThreshold > 0.0 && expansion.heuristic->isSkip(approximationThreshold);
+                    batch.push_back(std::move(expansion));
+                }
+
+                // Generate the successors of all states in the batch. This does not change the state space and can therefore be done in parallel.
+                // Rational functions share a polynomial cache which is not thread-safe, so only batches of doubles are expanded in parallel.
+#ifdef STORM_HAVE_INTELTBB
+                if (std::is_same<ValueType, double>::value && batch.size() > 1) {
+                    tbb::parallel_for(tbb::blocked_range<size_t>(0, batch.size()), [this, &batch] (tbb::blocked_range<size_t> const& range) {
+                        // The generator keeps track of the currently expanded state, so each task needs its own copy.
+                        storm::generator::DftNextStateGenerator<ValueType, StateType> localGenerator(generator);
+                        for (size_t index = range.begin(); index < range.end(); ++index) {
+                            if (!batch[index].skip) {
+                                expandState(batch[index], localGenerator);
+                            }
+                        }
+                    });
                 } else {
+#endif
+                    for (ExpandedState& expansion : batch) {
+                        if (!expansion.skip) {
+                            expandState(expansion, generator);
+                        }
+                    }
+#ifdef STORM_HAVE_INTELTBB
+                }
+#endif
+
+                // Register the successors and build the matrix in the order in which the states were taken from the queue.
+                // This keeps the resulting model independent of the number of threads.
+                for (ExpandedState& expansion : batch) {
+                    StateType currentId = expansion.id;
+                    STORM_LOG_ASSERT(stateStorage.stateToId.getValue(expansion.status) == currentId, "Ids of states do not coincide.");
+
+                    // Remember that the current row group was actually filled with the transitions of a different state
+                    matrixBuilder.setRemapping(currentId);
+
+                    matrixBuilder.newRowGroup();
+
+                    if (expansion.skip) {
+                        // Skip the current state
+                        ++nrSkippedStates;
+                        STORM_LOG_TRACE("Skip expansion of state: " << dft.getStateString(expansion.status, *stateGenerationInfo, currentId));
+                        setMarkovian(true);
+                        // Add transition to target state with temporary value 0
+                        // TODO: what to do when there is no unique target state?
+                        //STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
+                        matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
+                        // Remember skipped state. Its bucket is looked up again as successors of the batch may have caused a rehash.
+                        skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(stateStorage.stateToId.getBucket(expansion.status), expansion.heuristic);
+                        matrixBuilder.finishRow();
+                        continue;
+                    }
+
                     // Explore the current state
                     ++nrExpandedStates;
-                    storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
-                    STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
-                    setMarkovian(behavior.begin()->isMarkovian());
+                    // Add the successors in the order in which they were generated
+                    std::vector<StateType> successorIds;
+                    successorIds.reserve(expansion.successors.size());
+                    for (auto const& successor : expansion.successors) {
+                        successorIds.push_back(getOrAddStateIndex(successor.first));
+                    }
+                    STORM_LOG_ASSERT(!expansion.behavior.empty(), "Behavior is empty.");
+                    setMarkovian(expansion.behavior.begin()->isMarkovian());
 
                     // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        // Add the probabilistic behavior to the matrix.
+                    for (auto const& choice : expansion.behavior) {
+                        // Replace the temporary ids of the successors.
+                        // Several successors can correspond to the same state, so the transitions are accumulated.
+                        std::map<StateType, std::pair<ValueType, bool>> transitions;
                         for (auto const& stateProbabilityPair : choice) {
-                            STORM_LOG_ASSERT(!storm::utility::isZero(stateProbabilityPair.second), "Probability zero.");
+                            StateType targetId = stateProbabilityPair.first;
+                            bool expandTarget = false;
+                            if (targetId >= OFFSET_BATCH_SUCCESSOR) {
+                                STORM_LOG_ASSERT(targetId - OFFSET_BATCH_SUCCESSOR < successorIds.size(), "Successor " << targetId << " is unknown.");
+                                expandTarget = expansion.successors[targetId - OFFSET_BATCH_SUCCESSOR].second;
+                                targetId = successorIds[targetId - OFFSET_BATCH_SUCCESSOR];
+                            }
+                            auto iterTransition = transitions.find(targetId);
+                            if (iterTransition == transitions.end()) {
+                                transitions.emplace(targetId, std::make_pair(stateProbabilityPair.second, expandTarget));
+                            } else {
+                                iterTransition->second.first += stateProbabilityPair.second;
+                                iterTransition->second.second = iterTransition->second.second || expandTarget;
+                            }
+                        }
+
+                        // Add the probabilistic behavior to the matrix.
+                        for (auto const& transition : transitions) {
+                            StateType targetId = transition.first;
+                            ValueType const& probability = transition.second.first;
+                            STORM_LOG_ASSERT(!storm::utility::isZero(probability), "Probability zero.");
                             // Set transition to state id + offset. This helps in only remapping all previously skipped states.
-                            matrixBuilder.addTransition(matrixBuilder.mappingOffset + stateProbabilityPair.first, stateProbabilityPair.second);
+                            matrixBuilder.addTransition(matrixBuilder.mappingOffset + targetId, probability);
                             // Set heuristic values for reached states
-                            auto iter = statesNotExplored.find(stateProbabilityPair.first);
+                            auto iter = statesNotExplored.find(targetId);
                             if (iter != statesNotExplored.end()) {
                                 // Update heuristic values
-                                DFTStatePointer state = iter->second.first;
                                 if (!iter->second.second) {
                                     // Initialize heuristic values
                                     ExplorationHeuristicPointer heuristic;
                                     switch (usedHeuristic) {
                                         case storm::builder::ApproximationHeuristic::DEPTH:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                            heuristic = std::make_shared<DFTExplorationHeuristicDepth<ValueType>>(targetId, *expansion.heuristic, probability, choice.getTotalMass());
                                             break;
                                         case storm::builder::ApproximationHeuristic::PROBABILITY:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                            heuristic = std::make_shared<DFTExplorationHeuristicProbability<ValueType>>(targetId, *expansion.heuristic, probability, choice.getTotalMass());
                                             break;
                                         case storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(stateProbabilityPair.first, *currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass());
+                                            heuristic = std::make_shared<DFTExplorationHeuristicBoundDifference<ValueType>>(targetId, *expansion.heuristic, probability, choice.getTotalMass());
                                             break;
                                         default:
                                             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
                                     }
 
                                     iter->second.second = heuristic;
-                                    //if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) || state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                    if (state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
-                                            // Do not skip absorbing state or if reached by dependencies
+                                    if (transition.second.second) {
+                                        // Do not skip absorbing state or if reached by dependencies
                                         iter->second.second->markExpand();
                                     }
                                     if (usedHeuristic == storm::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
                                         // Compute bounds for heuristic now
-                                        if (state->isPseudoState()) {
-                                            // Create concrete state from pseudo state
-                                            state->construct();
-                                        }
-                                        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                                        DFTStatePointer state = reconstructState(stateStorage.stateToId.getBucketAndValue(iter->second.first).first, targetId);
 
                                         // Initialize bounds
                                         // TODO: avoid hack
@@ -467,7 +518,7 @@ namespace storm {
                                     explorationQueue.push(heuristic);
                                 } else if (!iter->second.second->isExpand()) {
                                     double oldPriority = iter->second.second->getPriority();
-                                    if (iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second, choice.getTotalMass())) {
+                                    if (iter->second.second->updateHeuristicValues(*expansion.heuristic, probability, choice.getTotalMass())) {
                                         // Update priority queue
                                         explorationQueue.update(iter->second.second, oldPriority);
                                     }
@@ -476,14 +527,15 @@ namespace storm {
                         }
                         matrixBuilder.finishRow();
                     }
+
+                    // Output number of currently explored states
+                    if (nrExpandedStates % 100 == 0) {
+                        progress.updateProgress(nrExpandedStates);
+                    }
                 }
                 if (storm::utility::resources::isTerminate()) {
                     break;
                 }
-                // Output number of currently explored states
-                if (nrExpandedStates % 100 == 0) {
-                    progress.updateProgress(nrExpandedStates);
-                }
             } // end exploration
 
             STORM_LOG_INFO("Expanded " << nrExpandedStates << " states");
@@ -491,6 +543,24 @@ namespace storm {
             STORM_LOG_ASSERT(nrSkippedStates == skippedStates.size(), "Nr skipped states is wrong");
         }
 
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::expandState(ExpandedState& expansion, storm::generator::DftNextStateGenerator<ValueType, StateType>& nextGenerator) const {
+            DFTStatePointer state = reconstructState(expansion.status, expansion.id);
+            nextGenerator.load(state);
+            std::vector<std::pair<storm::storage::BitVector, bool>>& successors = expansion.successors;
+            // Only collect the successors, they are added to the state space later on
+            expansion.behavior = nextGenerator.expand([this, &successors] (DFTStatePointer const& successor) {
+                // Do not skip absorbing state or if reached by dependencies
+                bool expandSuccessor = successor->getFailableElements().hasDependencies() || !successor->getFailableElements().hasBEs();
+                if (stateGenerationInfo->hasSymmetries()) {
+                    // Order state by symmetry
+                    successor->orderBySymmetry();
+                }
+                successors.emplace_back(successor->status(), expandSuccessor);
+                return static_cast<StateType>(OFFSET_BATCH_SUCCESSOR + successors.size() - 1);
+            });
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::buildLabeling() {
             bool isAddLabelsClaiming = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>().isAddLabelsClaiming();
@@ -604,7 +674,6 @@ namespace storm {
                     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                         auto matrixEntry = matrix.getRow(it->first, 0).begin();
                         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                         matrixEntry->setValue(storm::utility::one<ValueType>());
                         matrixEntry->setColumn(it->first);
                     }
@@ -720,13 +789,13 @@ namespace storm {
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
 
                 ExplorationHeuristicPointer heuristic = it->second.second;
                 if (storm::utility::isInfinity(heuristic->getUpperBound())) {
                     // Initialize bounds
-                    ValueType lowerBound = getLowerBound(it->second.first);
-                    ValueType upperBound = getUpperBound(it->second.first);
+                    DFTStatePointer state = reconstructState(stateStorage.stateToId.getBucketAndValue(it->second.first).first, heuristic->getId());
+                    ValueType lowerBound = getLowerBound(state);
+                    ValueType upperBound = getUpperBound(state);
                     heuristic->setBounds(lowerBound, upperBound);
                 }
 
@@ -883,53 +952,58 @@ namespace storm {
 
         template<typename ValueType, typename StateType>
         StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTStatePointer const& state) {
-            StateType stateId;
-            bool changed = false;
-
             if (stateGenerationInfo->hasSymmetries()) {
                 // Order state by symmetry
                 STORM_LOG_TRACE("Check for symmetry: " << dft.getStateString(state));
-                changed = state->orderBySymmetry();
+                bool changed = state->orderBySymmetry();
                 STORM_LOG_TRACE("State " << (changed ? "changed to " : "did not change") << (changed ? dft.getStateString(state) : ""));
             }
+            return getOrAddStateIndex(state->status());
+        }
 
-            if (stateStorage.stateToId.contains(state->status())) {
-                // State already exists
-                stateId = stateStorage.stateToId.getValue(state->status());
-                STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
-                if (!changed) {
-                    // Check if state is pseudo state
-                    // If state is explored already the possible pseudo state was already constructed
-                    auto iter = statesNotExplored.find(stateId);
-                    if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
-                        // Create pseudo state now
-                        STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                        STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
-                        state->setId(stateId);
-                        // Update mapping to map to concrete state now
-                        // TODO: just change pointer?
-                        statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
-                        // We do not push the new state on the exploration queue as the pseudo state was already pushed
-                        STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
-                    }
-                }
-            } else {
-                // State does not exist yet
-                STORM_LOG_ASSERT(state->isPseudoState() == changed, "State type (pseudo/concrete) wrong.");
-                // Create new state
-                state->setId(newIndex++);
-                stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
-                STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
+        template<typename ValueType, typename StateType>
+        StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(storm::storage::BitVector const& status) {
+            std::vector<uint64_t> bucketRemapping;
+            std::pair<StateType, uint64_t> idAndBucket = stateStorage.stateToId.findOrAddAndGetBucket(status, newIndex, bucketRemapping);
+            if (!bucketRemapping.empty()) {
+                // The state storage was rehashed
+                updateStateBuckets(bucketRemapping);
+            }
+            StateType stateId = idAndBucket.first;
+            if (stateId == newIndex) {
+                // State did not exist yet
+                ++newIndex;
                 // Insert state as not yet explored
                 ExplorationHeuristicPointer nullHeuristic;
-                statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+                statesNotExplored[stateId] = std::make_pair(idAndBucket.second, nullHeuristic);
                 // Reserve one slot for the new state in the remapping
                 matrixBuilder.stateRemapping.push_back(0);
-                STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
+                STORM_LOG_TRACE("New state: " << dft.getStateString(status, *stateGenerationInfo, stateId));
+            } else {
+                STORM_LOG_TRACE("State " << dft.getStateString(status, *stateGenerationInfo, stateId) << " with id " << stateId << " already exists");
             }
             return stateId;
         }
 
+        template<typename ValueType, typename StateType>
+        typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::reconstructState(storm::storage::BitVector const& status, StateType id) const {
+            // Only the status is stored, so the state is created as pseudo state and then made concrete
+            DFTStatePointer state = std::make_shared<storm::storage::DFTState<ValueType>>(status, dft, *stateGenerationInfo, id);
+            state->construct();
+            STORM_LOG_ASSERT(!state->isPseudoState(), "State is pseudo state.");
+            return state;
+        }
+
+        template<typename ValueType, typename StateType>
+        void ExplicitDFTModelBuilder<ValueType, StateType>::updateStateBuckets(std::vector<uint64_t> const& bucketRemapping) {
+            for (auto& stateEntry : statesNotExplored) {
+                stateEntry.second.first = bucketRemapping[stateEntry.second.first];
+            }
+            for (auto& skippedEntry : skippedStates) {
+                skippedEntry.second.first = bucketRemapping[skippedEntry.second.first];
+            }
+        }
+
         template<typename ValueType, typename StateType>
         void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian) {
             if (matrixBuilder.getCurrentRowGroup() > modelComponents.markovianStates.size()) {
@@ -943,7 +1017,7 @@ namespace storm {
         void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
             std::cout << "states not explored:" << std::endl;
             for (auto it : statesNotExplored) {
-                std::cout << it.first << " -> " << dft.getStateString(it.second.first) << std::endl;
+                std::cout << it.first << " -> " << dft.getStateString(stateStorage.stateToId.getBucketAndValue(it.second.first).first, *stateGenerationInfo, it.first) << std::endl;
             }
         }
 
@@ -149,6 +149,27 @@ namespace storm {
                 bool canHaveNondeterminism;
             };
 
+            // A structure holding a state which is expanded as part of a batch.
+            struct ExpandedState {
+                // Id of the state.
+                StateType id;
+
+                // Status of the state.
+                storm::storage::BitVector status;
+
+                // Heuristic values of the state.
+                ExplorationHeuristicPointer heuristic;
+
+                // Flag indicating whether the expansion of the state is skipped.
+                bool skip;
+
+                // The generated behavior. Successors which are not yet registered are referenced by OFFSET_BATCH_SUCCESSOR + (index in successors).
+                storm::generator::StateBehavior<ValueType, StateType> behavior;
+
+                // The status of the successors together with a flag indicating whether they must be expanded (because they are absorbing or reached by dependencies).
+                std::vector<std::pair<storm::storage::BitVector, bool>> successors;
+            };
+
         public:
             /*!
              * Constructor.
@@ -212,6 +233,44 @@ namespace storm {
              */
             StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+            /*!
+             * Add a state given by its (symmetry-ordered) status to the explored states (if not already there).
+             * The status is stored in the state storage. New states keep the bucket of their status in the state
+             * storage until they are explored.
+             *
+             * @param status The status of the state to add.
+             *
+             * @return Id of state.
+             */
+            StateType getOrAddStateIndex(storm::storage::BitVector const& status);
+
+            /*!
+             * Create the concrete state object for a state from its status.
+             *
+             * @param status Status of the state.
+             * @param id     Id of the state.
+             *
+             * @return The state.
+             */
+            DFTStatePointer reconstructState(storm::storage::BitVector const& status, StateType id) const;
+
+            /*!
+             * Update the buckets in the state storage of all states which are not yet expanded (including the skipped states).
+             * Must be called whenever the state storage was rehashed. The cost is linear in the number of these states.
+             *
+             * @param bucketRemapping Mapping from the buckets before rehashing to the buckets after rehashing.
+             */
+            void updateStateBuckets(std::vector<uint64_t> const& bucketRemapping);
+
+            /*!
+             * Expand the given state, i.e., compute its successor states and the transitions to them.
+             * The state space is not changed, such that several states can be expanded in parallel.
+             *
+             * @param expansion     The state to expand. The behavior and the successors are stored in here.
+             * @param nextGenerator The next state generator to use.
+             */
+            void expandState(ExpandedState& expansion, storm::generator::DftNextStateGenerator<ValueType, StateType>& nextGenerator) const;
+
             /*!
              * Set markovian flag for the current state.
              *
@@ -277,6 +336,9 @@ namespace storm {
              */
             std::shared_ptr<storm::models::sparse::Model<ValueType>> createModel(bool copy);
 
+            // Offset used for successors of states expanded in a batch whose ids have not been assigned yet.
+            const StateType OFFSET_BATCH_SUCCESSOR = std::numeric_limits<StateType>::max() / 2;
+
             // Initial size of the bitvector.
             const size_t INITIAL_BITVECTOR_SIZE = 20000;
             // Offset used for pseudo states.
@@ -317,14 +379,15 @@ namespace storm {
             // A priority queue of states that still need to be explored.
             storm::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
-            // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+            // A mapping of not yet explored states from the id to the tuple (bucket in the state storage, heuristic values).
+            // The status is read from the state storage, the state objects are only reconstructed when needed.
+            std::map<StateType, std::pair<uint64_t, ExplorationHeuristicPointer>> statesNotExplored;
 
             // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
-            // to the corresponding skipped states.
+            // to the corresponding skipped states (bucket in the state storage, heuristic values).
             // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
             // TODO remove again
-            std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+            std::map<StateType, std::pair<uint64_t, ExplorationHeuristicPointer>> skippedStates;
 
             // List of independent subtrees and the BEs contained in them.
             std::vector<std::vector<size_t>> subtreeBEs;
@@ -1,5 +1,19 @@
 #include "DFTModelChecker.h"
 
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
@@ -20,6 +34,21 @@
 namespace storm {
     namespace modelchecker {
 
+        template<typename ValueType>
+        DFTModelChecker<ValueType>::DFTModelChecker(bool printOutput) : printInfo(printOutput) {
+            setNumberOfModuleThreads(storm::settings::getModule<storm::settings::modules::FaultTreeSettings>().getModularisationThreads());
+        }
+
+        template<typename ValueType>
+        void DFTModelChecker<ValueType>::setNumberOfModuleThreads(uint64_t numberOfThreads) {
+            // The computations with (carl) rational numbers and functions are not thread-safe.
+            if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Modules are only analysed concurrently for double precision. Using a single thread.");
+                numberOfThreads = 1;
+            }
+            numberOfModuleThreads = numberOfThreads;
+        }
+
         template<typename ValueType>
         typename DFTModelChecker<ValueType>::dft_results DFTModelChecker<ValueType>::check(storm::storage::DFT<ValueType> const& origDft, std::vector<std::shared_ptr<const storm::logic::Formula>> const& properties,
                                                                                            bool symred, bool allowModularisation, storm::utility::RelevantEvents const& relevantEvents,
@@ -27,6 +56,21 @@ namespace storm {
                                                                                            bool eliminateChains, storm::transformer::EliminationLabelBehavior labelBehavior) {
             totalTimer.start();
             dft_results results;
+            auto const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+            std::string cacheFilename;
+            if (ftSettings.isResultCacheSet() && !resultCache) {
+                resultCache = std::make_shared<DFTResultCache<ValueType>>();
+                cacheFilename = ftSettings.getResultCacheFilename();
+                if (!cacheFilename.empty()) {
+                    if (std::is_same<ValueType, double>::value) {
+                        resultCache->load(cacheFilename);
+                        STORM_LOG_DEBUG("Loaded " << resultCache->size() << " cached results from '" << cacheFilename << "'.");
+                    } else {
+                        STORM_LOG_WARN("Cached results are only stored for double precision. The file '" << cacheFilename << "' is ignored.");
+                        cacheFilename = "";
+                    }
+                }
+            }
 
             // Check well-formedness of DFT
             auto wellFormedResult = storm::api::isWellFormed(origDft, true);
@@ -50,6 +94,12 @@ namespace storm {
             } else {
                 results = checkHelper(dft, properties, symred, allowModularisation, relevantEvents, approximationError, approximationHeuristic, eliminateChains, labelBehavior);
             }
+            if (resultCache) {
+                STORM_LOG_INFO("Reused cached results " << resultCache->getNumberOfHits() << " times, " << resultCache->size() << " results are cached.");
+                if (!cacheFilename.empty()) {
+                    resultCache->save(cacheFilename);
+                }
+            }
             totalTimer.stop();
             return results;
         }
@@ -60,6 +110,16 @@ namespace storm {
                                                                                                  double approximationError, storm::builder::ApproximationHeuristic approximationHeuristic,
                                                                                                  bool eliminateChains, storm::transformer::EliminationLabelBehavior labelBehavior) {
             STORM_LOG_TRACE("Check helper called");
+            std::string cacheKey;
+            if (resultCache) {
+                cacheKey = getCacheKey(dft, properties, relevantEvents, approximationError, approximationHeuristic);
+                boost::optional<dft_results> cachedResults = resultCache->find(cacheKey);
+                if (cachedResults) {
+                    STORM_LOG_DEBUG("Reusing cached results for " << dft.getTopLevelGate()->name() << ".");
+                    return cachedResults.get();
+                }
+            }
+
             std::vector<storm::storage::DFT<ValueType>> dfts;
             bool invResults = false;
             size_t nrK = 0; // K out of M
@@ -98,59 +158,203 @@ namespace storm {
                 }
             }
 
+            dft_results results;
             // Perform modularisation
             if (dfts.size() > 1) {
                 STORM_LOG_DEBUG("Modularisation of " << dft.getTopLevelGate()->name() << " into " << dfts.size() << " submodules.");
-                // TODO: compute simultaneously
-                dft_results results;
+                property_vector moduleProperties;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
-                        std::vector<ValueType> res;
-                        for (auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
-                        }
+                        moduleProperties.push_back(property);
+                    }
+                }
 
-                        // Combine modularisation results
-                        STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
-                                                                      << (invResults ? "On" : "Off"));
-                        ValueType result = storm::utility::zero<ValueType>();
-                        int limK = invResults ? -1 : nrM + 1;
-                        int chK = invResults ? -1 : 1;
-                        for (int cK = nrK; cK != limK; cK += chK) {
-                            STORM_LOG_ASSERT(cK >= 0, "ck negative.");
-                            uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
-                            do {
-                                STORM_LOG_TRACE("Permutation=" << permutation);
-                                ValueType permResult = storm::utility::one<ValueType>();
-                                for (size_t i = 0; i < res.size(); ++i) {
-                                    if (permutation & (1ul << i)) {
-                                        permResult *= res[i];
-                                    } else {
-                                        permResult *= storm::utility::one<ValueType>() - res[i];
-                                    }
-                                }
-                                STORM_LOG_TRACE("Result for permutation:" << permResult);
-                                permutation = nextBitPermutation(permutation);
-                                result += permResult;
-                            } while (permutation < (1ul << nrM) && permutation != 0);
+                // The failure probability of the DFT changes by at most the change of the failure probability of a module.
+                // Thus, the absolute error of the combined result is bounded by the sum of the errors of all modules.
+                double moduleApproximationError = approximationError / dfts.size();
+                // Recursively call model checking
+                std::vector<dft_results> moduleResults = checkModules(dfts, moduleProperties, symred, relevantEvents, moduleApproximationError, approximationHeuristic);
+
+                // Combine modularisation results
+                for (size_t propertyIndex = 0; propertyIndex < moduleProperties.size(); ++propertyIndex) {
+                    std::vector<ValueType> lowerBounds;
+                    std::vector<ValueType> upperBounds;
+                    bool exact = true;
+                    for (size_t moduleIndex = 0; moduleIndex < dfts.size(); ++moduleIndex) {
+                        auto const& moduleResult = moduleResults[moduleIndex][propertyIndex];
+                        if (moduleResult.which() == 0) {
+                            lowerBounds.push_back(boost::get<ValueType>(moduleResult));
+                            upperBounds.push_back(boost::get<ValueType>(moduleResult));
+                        } else {
+                            exact = false;
+                            lowerBounds.push_back(boost::get<approximation_result>(moduleResult).first);
+                            upperBounds.push_back(boost::get<approximation_result>(moduleResult).second);
                         }
-                        if (invResults) {
-                            result = storm::utility::one<ValueType>() - result;
-                        }
-                        results.push_back(result);
+                    }
+                    // The combination is monotone in the module results, so bounds are combined into bounds
+                    if (exact) {
+                        results.push_back(combineModuleResults(lowerBounds, nrK, nrM, invResults));
+                    } else {
+                        results.push_back(std::make_pair(combineModuleResults(lowerBounds, nrK, nrM, invResults), combineModuleResults(upperBounds, nrK, nrM, invResults)));
                     }
                 }
-                return results;
             } else {
                 // No modularisation was possible
-                return checkDFT(dft, properties, symred, relevantEvents, approximationError, approximationHeuristic, eliminateChains, labelBehavior);
+                results = checkDFT(dft, properties, symred, relevantEvents, approximationError, approximationHeuristic, eliminateChains, labelBehavior);
+            }
+
+            if (resultCache) {
+                resultCache->insert(cacheKey, results);
+            }
+            return results;
+        }
+
+        template<typename ValueType>
+        std::string DFTModelChecker<ValueType>::getCacheKey(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, storm::utility::RelevantEvents const& relevantEvents,
+                                                            double approximationError, storm::builder::ApproximationHeuristic approximationHeuristic) const {
+            std::stringstream stream;
+            stream << DFTResultCache<ValueType>::canonicalForm(dft, relevantEvents);
+            for (auto const& property : properties) {
+                stream << "|" << *property;
+            }
+            // Options influencing the results
+            auto const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+            stream << "|" << std::setprecision(std::numeric_limits<double>::max_digits10) << approximationError << "|" << static_cast<int>(approximationHeuristic);
+            if (ftSettings.isMaxDepthSet()) {
+                stream << "|" << ftSettings.getMaxDepth();
+            }
+            stream << "|" << ftSettings.isTakeFirstDependency();
+            if (ftSettings.isAddLabelsClaiming()) {
+                // Claiming labels refer to the names of all spares and their children
+                for (size_t id = 0; id < dft.nrElements(); ++id) {
+                    stream << "|" << dft.getElement(id)->name();
+                }
+            }
+            // The solver environment used for model checking (see checkModel) and bisimulation also influence the results
+            storm::Environment env;
+            auto const& solverEnv = env.solver();
+            stream << "|" << solverEnv.isForceSoundness() << "|" << solverEnv.isForceExact();
+            auto linearEquationSolverPrecision = solverEnv.getPrecisionOfLinearEquationSolver(solverEnv.getLinearEquationSolverType());
+            stream << "|" << static_cast<int>(solverEnv.getLinearEquationSolverType());
+            if (linearEquationSolverPrecision.first) {
+                stream << "|" << linearEquationSolverPrecision.first.get();
+            }
+            if (linearEquationSolverPrecision.second) {
+                stream << "|" << linearEquationSolverPrecision.second.get();
+            }
+            stream << "|" << static_cast<int>(solverEnv.minMax().getMethod()) << "|" << solverEnv.minMax().getPrecision() << "|" << solverEnv.minMax().getRelativeTerminationCriterion();
+            stream << "|" << static_cast<int>(solverEnv.timeBounded().getMaMethod()) << "|" << solverEnv.timeBounded().getPrecision() << "|" << solverEnv.timeBounded().getRelativeTerminationCriterion();
+            stream << "|" << storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet();
+            return stream.str();
+        }
+
+        template<typename ValueType>
+        std::vector<typename DFTModelChecker<ValueType>::dft_results> DFTModelChecker<ValueType>::checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred,
+                                                                                                              storm::utility::RelevantEvents const& relevantEvents, double approximationError,
+                                                                                                              storm::builder::ApproximationHeuristic approximationHeuristic) {
+            std::vector<dft_results> results(dfts.size());
+            // A module is only analysed by one checker at a time as setting the relevant events modifies the DFT.
+            auto checkModule = [&] (DFTModelChecker<ValueType>& checker, size_t moduleIndex) {
+                for (auto const& property : properties) {
+                    dft_results ftResults = checker.checkHelper(dfts[moduleIndex], {property}, symred, true, relevantEvents, approximationError, approximationHeuristic);
+                    STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
+                    results[moduleIndex].push_back(ftResults[0]);
+                }
+            };
+
+            uint64_t numberOfThreads = std::min<uint64_t>(numberOfModuleThreads, dfts.size());
+            if (numberOfThreads <= 1) {
+                for (size_t moduleIndex = 0; moduleIndex < dfts.size(); ++moduleIndex) {
+                    checkModule(*this, moduleIndex);
+                }
+                return results;
+            }
+
+            STORM_LOG_DEBUG("Analysing " << dfts.size() << " modules with " << numberOfThreads << " threads.");
+            // Each thread uses its own checker (with its own timers). Nested modules are analysed sequentially.
+            std::vector<std::unique_ptr<DFTModelChecker<ValueType>>> checkers;
+            for (uint64_t i = 0; i < numberOfThreads; ++i) {
+                checkers.push_back(std::make_unique<DFTModelChecker<ValueType>>(false));
+                checkers.back()->setNumberOfModuleThreads(1);
+                checkers.back()->resultCache = resultCache;
+                checkers.back()->totalTimer.start();
+            }
+            std::atomic<size_t> nextModule(0);
+            std::mutex mutex;
+            std::exception_ptr firstException;
+            auto worker = [&] (DFTModelChecker<ValueType>& checker) {
+                while (true) {
+                    size_t moduleIndex = nextModule++;
+                    if (moduleIndex >= dfts.size()) {
+                        return;
+                    }
+                    try {
+                        checkModule(checker, moduleIndex);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!firstException) {
+                            firstException = std::current_exception();
+                        }
+                        // Skip the remaining modules
+                        nextModule = dfts.size();
+                        return;
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(numberOfThreads);
+            for (auto& checker : checkers) {
+                threads.emplace_back(worker, std::ref(*checker));
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (firstException) {
+                std::rethrow_exception(firstException);
+            }
+
+            // The timers accumulate the times of all threads
+            for (auto const& checker : checkers) {
+                explorationTimer.add(checker->explorationTimer);
+                buildingTimer.add(checker->buildingTimer);
+                bisimulationTimer.add(checker->bisimulationTimer);
+                modelCheckingTimer.add(checker->modelCheckingTimer);
+            }
+            return results;
+        }
+
+        template<typename ValueType>
+        ValueType DFTModelChecker<ValueType>::combineModuleResults(std::vector<ValueType> const& moduleResults, size_t nrK, size_t nrM, bool invResults) const {
+            STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
+                                                          << (invResults ? "On" : "Off"));
+            ValueType result = storm::utility::zero<ValueType>();
+            int limK = invResults ? -1 : nrM + 1;
+            int chK = invResults ? -1 : 1;
+            for (int cK = nrK; cK != limK; cK += chK) {
+                STORM_LOG_ASSERT(cK >= 0, "ck negative.");
+                uint64_t permutation = smallestIntWithNBitsSet(static_cast<uint64_t>(cK));
+                do {
+                    STORM_LOG_TRACE("Permutation=" << permutation);
+                    ValueType permResult = storm::utility::one<ValueType>();
+                    for (size_t i = 0; i < moduleResults.size(); ++i) {
+                        if (permutation & (1ul << i)) {
+                            permResult *= moduleResults[i];
+                        } else {
+                            permResult *= storm::utility::one<ValueType>() - moduleResults[i];
+                        }
+                    }
+                    STORM_LOG_TRACE("Result for permutation:" << permResult);
+                    permutation = nextBitPermutation(permutation);
+                    result += permResult;
+                } while (permutation < (1ul << nrM) && permutation != 0);
+            }
+            if (invResults) {
+                result = storm::utility::one<ValueType>() - result;
             }
+            return result;
         }
 
         template<typename ValueType>
@@ -6,6 +6,7 @@
 #include "storm/utility/Stopwatch.h"
 
 #include "storm-dft/storage/dft/DFT.h"
+#include "storm-dft/modelchecker/dft/DFTResultCache.h"
 #include "storm-dft/utility/RelevantEvents.h"
 
 
@@ -37,8 +38,7 @@ namespace storm {
             /*!
              * Constructor.
              */
-            DFTModelChecker(bool printOutput) : printInfo(printOutput) {
-            }
+            DFTModelChecker(bool printOutput);
 
             /*!
              * Main method for checking DFTs.
@@ -58,6 +58,25 @@ namespace storm {
                               double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                               bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Set the cache for the results of DFT modules.
+             * The cache can be shared between several model checkers to reuse results across analyses.
+             * If no cache is set, a cache is created if the corresponding option is set.
+             *
+             * @param cache Result cache.
+             */
+            void setResultCache(std::shared_ptr<DFTResultCache<ValueType>> const& cache) {
+                resultCache = cache;
+            }
+
+            /*!
+             * Set the number of threads used to analyse independent modules concurrently.
+             * Only computations with doubles use more than one thread.
+             *
+             * @param numberOfThreads Number of threads.
+             */
+            void setNumberOfModuleThreads(uint64_t numberOfThreads);
+
             /*!
              * Print timings of all operations to stream.
              *
@@ -77,6 +96,12 @@ namespace storm {
 
             bool printInfo;
 
+            // Number of threads used to analyse independent modules concurrently
+            uint64_t numberOfModuleThreads = 1;
+
+            // Cache for the results of (isomorphic) modules
+            std::shared_ptr<DFTResultCache<ValueType>> resultCache;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
@@ -102,6 +127,45 @@ namespace storm {
                                     double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                                     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Compute the key under which the results of the given analysis are cached.
+             *
+             * @param dft DFT.
+             * @param properties Properties to check for.
+             * @param relevantEvents Relevant events which should be observed.
+             * @param approximationError Error allowed for approximation. Value 0 indicates no approximation.
+             * @param approximationHeuristic Heuristic used for approximation.
+             * @return Cache key.
+             */
+            std::string getCacheKey(storm::storage::DFT<ValueType> const& dft, property_vector const& properties, storm::utility::RelevantEvents const& relevantEvents,
+                                    double approximationError, storm::builder::ApproximationHeuristic approximationHeuristic) const;
+
+            /*!
+             * Internal helper for model checking the independent modules of a DFT.
+             * The modules are analysed concurrently if more than one thread is allowed.
+             *
+             * @param dfts The modules.
+             * @param properties Properties to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents Relevant events which should be observed.
+             * @param approximationError Error allowed for the approximation of each module. Value 0 indicates no approximation.
+             * @param approximationHeuristic Heuristic used for approximation.
+             * @return For each module, the model checking results for all properties.
+             */
+            std::vector<dft_results> checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, storm::utility::RelevantEvents const& relevantEvents,
+                                                  double approximationError, storm::builder::ApproximationHeuristic approximationHeuristic);
+
+            /*!
+             * Combine the failure probabilities of independent modules into the failure probability of the DFT.
+             *
+             * @param moduleResults Failure probabilities of the modules.
+             * @param nrK The number K of modules that has to fail (K out of M).
+             * @param nrM The number M of modules.
+             * @param invResults Flag indicating if the complementary event is computed.
+             * @return Failure probability of the DFT.
+             */
+            ValueType combineModuleResults(std::vector<ValueType> const& moduleResults, size_t nrK, size_t nrM, bool invResults) const;
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
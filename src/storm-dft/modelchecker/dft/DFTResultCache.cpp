@@ -0,0 +1,297 @@
+#include "DFTResultCache.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/functional/hash.hpp>
+
+#include "storm/io/file.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+
+namespace storm {
+    namespace modelchecker {
+
+        namespace {
+            /*!
+             * Describe the properties of an element which do not refer to other elements.
+             */
+            template<typename ValueType>
+            std::string describeElement(storm::storage::DFT<ValueType> const& dft, size_t id, storm::utility::RelevantEvents const& relevantEvents) {
+                std::stringstream stream;
+                stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+                auto element = dft.getElement(id);
+                stream << element->typestring();
+                switch (element->type()) {
+                    case storm::storage::DFTElementType::BE: {
+                        auto be = dft.getBasicElement(id);
+                        stream << " " << be->beType();
+                        switch (be->beType()) {
+                            case storm::storage::BEType::CONSTANT:
+                                stream << " " << std::static_pointer_cast<storm::storage::BEConst<ValueType> const>(be)->failed();
+                                break;
+                            case storm::storage::BEType::EXPONENTIAL: {
+                                auto beExp = std::static_pointer_cast<storm::storage::BEExponential<ValueType> const>(be);
+                                stream << " " << beExp->activeFailureRate() << " " << beExp->passiveFailureRate() << " " << beExp->isTransient();
+                                break;
+                            }
+                            case storm::storage::BEType::SAMPLES:
+                                for (auto const& sample : std::static_pointer_cast<storm::storage::BESamples<ValueType> const>(be)->activeSamples()) {
+                                    stream << " " << sample.first << ":" << sample.second;
+                                }
+                                break;
+                            default:
+                                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BE type '" << be->beType() << "' is not supported.");
+                        }
+                        break;
+                    }
+                    case storm::storage::DFTElementType::VOT:
+                        stream << " " << std::static_pointer_cast<storm::storage::DFTVot<ValueType> const>(element)->threshold();
+                        break;
+                    case storm::storage::DFTElementType::PAND:
+                        stream << " " << std::static_pointer_cast<storm::storage::DFTPand<ValueType> const>(element)->isInclusive();
+                        break;
+                    case storm::storage::DFTElementType::POR:
+                        stream << " " << std::static_pointer_cast<storm::storage::DFTPor<ValueType> const>(element)->isInclusive();
+                        break;
+                    case storm::storage::DFTElementType::PDEP:
+                        stream << " " << dft.getDependency(id)->probability();
+                        break;
+                    default:
+                        break;
+                }
+                // The names of relevant events occur in the labels of the model.
+                // The top level element is always relevant but its name only matters if it is given as relevant event as well.
+                if (relevantEvents.isRelevant(element->name())) {
+                    stream << " !" << element->name().size() << ":" << element->name();
+                }
+                return stream.str();
+            }
+        }
+
+        template<typename ValueType>
+        std::string DFTResultCache<ValueType>::canonicalForm(storm::storage::DFT<ValueType> const& dft, storm::utility::RelevantEvents const& relevantEvents) {
+            size_t nrElements = dft.nrElements();
+            std::vector<std::string> descriptions;
+            descriptions.reserve(nrElements);
+            for (size_t id = 0; id < nrElements; ++id) {
+                descriptions.push_back(describeElement(dft, id, relevantEvents));
+            }
+
+            // Hash the sub-tree below each gate or BE. The hash is independent of the order of children of static gates.
+            std::vector<boost::optional<size_t>> subtreeHashes(nrElements);
+            std::function<size_t(size_t)> subtreeHash = [&](size_t id) -> size_t {
+                if (!subtreeHashes[id]) {
+                    size_t hash = std::hash<std::string>()(descriptions[id]);
+                    if (dft.isGate(id)) {
+                        auto gate = dft.getGate(id);
+                        std::vector<size_t> childHashes;
+                        for (auto const& child : gate->children()) {
+                            childHashes.push_back(subtreeHash(child->id()));
+                        }
+                        if (storm::storage::isStaticGateType(gate->type())) {
+                            std::sort(childHashes.begin(), childHashes.end());
+                        }
+                        for (size_t childHash : childHashes) {
+                            boost::hash_combine(hash, childHash);
+                        }
+                    }
+                    subtreeHashes[id] = hash;
+                }
+                return subtreeHashes[id].get();
+            };
+
+            // Children of static gates are ordered by their sub-trees, the order of all other children is significant
+            auto orderedChildren = [&](size_t id) {
+                std::vector<size_t> children;
+                auto gate = dft.getGate(id);
+                for (auto const& child : gate->children()) {
+                    children.push_back(child->id());
+                }
+                if (storm::storage::isStaticGateType(gate->type())) {
+                    std::stable_sort(children.begin(), children.end(), [&](size_t lhs, size_t rhs) { return subtreeHash(lhs) < subtreeHash(rhs); });
+                }
+                return children;
+            };
+
+            // Number the elements in depth-first order starting from the top level element
+            std::vector<size_t> numbers(nrElements, nrElements);
+            std::vector<size_t> order;
+            order.reserve(nrElements);
+            auto numberSubtree = [&](size_t root) {
+                std::vector<size_t> stack = {root};
+                while (!stack.empty()) {
+                    size_t id = stack.back();
+                    stack.pop_back();
+                    if (numbers[id] != nrElements) {
+                        continue;
+                    }
+                    numbers[id] = order.size();
+                    order.push_back(id);
+                    if (dft.isGate(id)) {
+                        std::vector<size_t> children = orderedChildren(id);
+                        stack.insert(stack.end(), children.rbegin(), children.rend());
+                    }
+                }
+            };
+            numberSubtree(dft.getTopLevelIndex());
+            // Elements which are not below the top level element, e.g., triggers of dependencies
+            std::vector<size_t> remaining;
+            for (size_t id = 0; id < nrElements; ++id) {
+                if (numbers[id] == nrElements && !dft.isDependency(id) && !dft.isRestriction(id)) {
+                    remaining.push_back(id);
+                }
+            }
+            std::stable_sort(remaining.begin(), remaining.end(), [&](size_t lhs, size_t rhs) { return subtreeHash(lhs) < subtreeHash(rhs); });
+            for (size_t id : remaining) {
+                numberSubtree(id);
+            }
+            // Dependencies and restrictions keep their order as the first dependency might be preferred during exploration
+            for (size_t id = 0; id < nrElements; ++id) {
+                if (dft.isDependency(id) || dft.isRestriction(id)) {
+                    numbers[id] = order.size();
+                    order.push_back(id);
+                }
+            }
+            STORM_LOG_ASSERT(order.size() == nrElements, "Not all elements were numbered.");
+
+            std::stringstream stream;
+            stream << (relevantEvents.isAllowDC() ? "dc" : "nodc");
+            for (size_t id : order) {
+                stream << ";" << descriptions[id] << "(";
+                if (dft.isGate(id)) {
+                    for (size_t child : orderedChildren(id)) {
+                        stream << numbers[child] << ",";
+                    }
+                } else if (dft.isDependency(id)) {
+                    auto dependency = dft.getDependency(id);
+                    stream << numbers[dependency->triggerEvent()->id()] << ":";
+                    for (auto const& dependentEvent : dependency->dependentEvents()) {
+                        stream << numbers[dependentEvent->id()] << ",";
+                    }
+                } else if (dft.isRestriction(id)) {
+                    for (auto const& child : dft.getRestriction(id)->children()) {
+                        stream << numbers[child->id()] << ",";
+                    }
+                }
+                stream << ")";
+            }
+            return stream.str();
+        }
+
+        template<typename ValueType>
+        boost::optional<typename DFTResultCache<ValueType>::dft_results> DFTResultCache<ValueType>::find(std::string const& key) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = results.find(key);
+            if (it == results.end()) {
+                return boost::none;
+            }
+            ++hits;
+            return it->second;
+        }
+
+        template<typename ValueType>
+        void DFTResultCache<ValueType>::insert(std::string const& key, dft_results const& newResults) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results[key] = newResults;
+        }
+
+        template<typename ValueType>
+        size_t DFTResultCache<ValueType>::size() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return results.size();
+        }
+
+        template<typename ValueType>
+        size_t DFTResultCache<ValueType>::getNumberOfHits() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return hits;
+        }
+
+        template<typename ValueType>
+        void DFTResultCache<ValueType>::load(std::string const& filename) {
+            if (!storm::utility::fileExistsAndIsReadable(filename)) {
+                STORM_LOG_INFO("Result cache file '" << filename << "' does not exist yet.");
+                return;
+            }
+            std::ifstream stream;
+            storm::utility::openFile(filename, stream);
+            std::lock_guard<std::mutex> lock(mutex);
+            // Each line contains the key followed by the results separated by tabs. Approximated results are given as 'lower,upper'.
+            std::string line;
+            while (storm::utility::getline(stream, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                std::vector<std::string> entries;
+                boost::split(entries, line, boost::is_any_of("\t"));
+                STORM_LOG_THROW(entries.size() >= 2, storm::exceptions::WrongFormatException, "Line '" << line << "' of result cache file '" << filename << "' is malformed.");
+                dft_results lineResults;
+                for (auto it = entries.begin() + 1; it != entries.end(); ++it) {
+                    size_t separator = it->find(',');
+                    if (separator == std::string::npos) {
+                        lineResults.push_back(storm::utility::convertNumber<ValueType>(*it));
+                    } else {
+                        lineResults.push_back(std::make_pair(storm::utility::convertNumber<ValueType>(it->substr(0, separator)), storm::utility::convertNumber<ValueType>(it->substr(separator + 1))));
+                    }
+                }
+                results[entries.front()] = lineResults;
+            }
+            storm::utility::closeFile(stream);
+        }
+
+        template<typename ValueType>
+        void DFTResultCache<ValueType>::save(std::string const& filename) const {
+            std::ofstream stream;
+            storm::utility::openFile(filename, stream, false, true);
+            stream << std::setprecision(std::numeric_limits<ValueType>::max_digits10);
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto const& entry : results) {
+                if (entry.first.find_first_of("\t\n") != std::string::npos) {
+                    STORM_LOG_WARN("Skipping cached result with key containing tabs or line breaks.");
+                    continue;
+                }
+                stream << entry.first;
+                for (auto const& result : entry.second) {
+                    if (result.which() == 0) {
+                        stream << "\t" << boost::get<ValueType>(result);
+                    } else {
+                        auto const& bounds = boost::get<approximation_result>(result);
+                        stream << "\t" << bounds.first << "," << bounds.second;
+                    }
+                }
+                stream << std::endl;
+            }
+            storm::utility::closeFile(stream);
+        }
+
+        // Explicitly instantiate the class.
+        template
+        class DFTResultCache<double>;
+
+#ifdef STORM_HAVE_CARL
+
+        template<>
+        void DFTResultCache<storm::RationalFunction>::load(std::string const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storing cached results is only supported for double precision.");
+        }
+
+        template<>
+        void DFTResultCache<storm::RationalFunction>::save(std::string const&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storing cached results is only supported for double precision.");
+        }
+
+        template
+        class DFTResultCache<storm::RationalFunction>;
+
+#endif
+    }
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-dft/storage/dft/DFT.h"
+#include "storm-dft/utility/RelevantEvents.h"
+
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Cache for the analysis results of DFT modules.
+         * Results are addressed by a canonical form of the module which is independent of element names and ids,
+         * such that isomorphic modules occurring in the same DFT or in different DFTs share their results.
+         * The cache can be stored in a file and thus be reused across several runs.
+         * All operations are thread-safe.
+         */
+        template<typename ValueType>
+        class DFTResultCache {
+
+        public:
+            typedef std::pair<ValueType, ValueType> approximation_result;
+            typedef std::vector<boost::variant<ValueType, approximation_result>> dft_results;
+
+            /*!
+             * Compute the canonical form of a DFT.
+             * Equal canonical forms imply that the DFTs are isomorphic (including failure rates, probabilities and relevant events).
+             * Isomorphic DFTs obtain the same canonical form in most cases as the children of static gates are ordered by the structure of their sub-trees.
+             * Ties between structurally equal children and the order of dependencies and restrictions are kept from the given DFT.
+             *
+             * @param dft DFT.
+             * @param relevantEvents Relevant events which should be observed.
+             * @return Canonical form.
+             */
+            static std::string canonicalForm(storm::storage::DFT<ValueType> const& dft, storm::utility::RelevantEvents const& relevantEvents);
+
+            /*!
+             * Get the cached results for the given key.
+             *
+             * @param key Key.
+             * @return Cached results if they exist.
+             */
+            boost::optional<dft_results> find(std::string const& key);
+
+            /*!
+             * Store the results for the given key.
+             *
+             * @param key Key.
+             * @param results Results.
+             */
+            void insert(std::string const& key, dft_results const& results);
+
+            /*!
+             * @return Number of cached results.
+             */
+            size_t size() const;
+
+            /*!
+             * @return Number of successful lookups.
+             */
+            size_t getNumberOfHits() const;
+
+            /*!
+             * Add the results stored in the given file. Nothing is done if the file does not exist.
+             * Only supported for double precision.
+             *
+             * @param filename File.
+             */
+            void load(std::string const& filename);
+
+            /*!
+             * Store all results in the given file.
+             * Only supported for double precision.
+             *
+             * @param filename File.
+             */
+            void save(std::string const& filename) const;
+
+        private:
+            mutable std::mutex mutex;
+            std::map<std::string, dft_results> results;
+            size_t hits = 0;
+        };
+
+#ifdef STORM_HAVE_CARL
+        // Results for rational functions can not be stored in files.
+        template<>
+        void DFTResultCache<storm::RationalFunction>::load(std::string const& filename);
+
+        template<>
+        void DFTResultCache<storm::RationalFunction>::save(std::string const& filename) const;
+#endif
+
+    }
+}
@@ -28,6 +28,9 @@ namespace storm {
             const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
             const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+            const std::string FaultTreeSettings::parallelExplorationOptionName = "parallelexploration";
+            const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisationthreads";
+            const std::string FaultTreeSettings::resultCacheOptionName = "resultcache";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -36,6 +39,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.").setShortName(
                         noSymmetryReductionOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false, "Number of threads used to analyse independent modules concurrently.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads.").setDefaultValueUnsignedInteger(1)
+                                                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false,
                                                                "Avoid non-determinism by always taking the first possible dependency.").build());
@@ -59,6 +65,13 @@ namespace storm {
                         storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false,
                                                                "Use a unique constantly failed BE.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false,
+                                                               "Expand the states of the exploration queue in parallel batches (requires Intel TBB). The resulting model does not depend on the number of threads.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch", "The number of states expanded in one batch.").setDefaultValueUnsignedInteger(1000).makeOptional()
+                                                             .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, resultCacheOptionName, false,
+                                                               "Reuse the results of isomorphic DFT modules. If a file is given, the results are loaded from and stored to it (only for double precision).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("file", "The file storing the cached results.").setDefaultValueString("").makeOptional().build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -129,6 +142,30 @@ namespace storm {
                 return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
             }
 
+            bool FaultTreeSettings::isParallelExplorationSet() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> FaultTreeSettings::overrideParallelExplorationSet(bool stateToSet) {
+                return this->overrideOption(parallelExplorationOptionName, stateToSet);
+            }
+
+            uint_fast64_t FaultTreeSettings::getParallelExplorationBatchSize() const {
+                return this->getOption(parallelExplorationOptionName).getArgumentByName("batch").getValueAsUnsignedInteger();
+            }
+
+            uint_fast64_t FaultTreeSettings::getModularisationThreads() const {
+                return this->getOption(modularisationThreadsOptionName).getArgumentByName("threads").getValueAsUnsignedInteger();
+            }
+
+            bool FaultTreeSettings::isResultCacheSet() const {
+                return this->getOption(resultCacheOptionName).getHasOptionBeenSet();
+            }
+
+            std::string FaultTreeSettings::getResultCacheFilename() const {
+                return this->getOption(resultCacheOptionName).getArgumentByName("file").getValueAsString();
+            }
+
 #ifdef STORM_HAVE_Z3
 
             bool FaultTreeSettings::solveWithSMT() const {
@@ -117,6 +117,50 @@ namespace storm {
                   */
                 bool isUniqueFailedBE() const;
 
+                /*!
+                 * Retrieves whether the state space should be explored in parallel batches.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isParallelExplorationSet() const;
+
+                /*!
+                 * Overrides the option to explore the state space in parallel batches by setting it to the specified
+                 * value. As soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideParallelExplorationSet(bool stateToSet);
+
+                /*!
+                 * Retrieves the number of states which are expanded together in one batch.
+                 *
+                 * @return The batch size.
+                 */
+                uint_fast64_t getParallelExplorationBatchSize() const;
+
+                /*!
+                 * Retrieves the number of threads used to analyse independent modules.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getModularisationThreads() const;
+
+                /*!
+                 * Retrieves whether analysis results of DFT modules should be cached and reused.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isResultCacheSet() const;
+
+                /*!
+                 * Retrieves the file in which the cached analysis results are stored between runs.
+                 *
+                 * @return The file name. An empty name indicates that the cache is not stored.
+                 */
+                std::string getResultCacheFilename() const;
+
 #ifdef STORM_HAVE_Z3
 
                 /*!
@@ -150,6 +194,9 @@ namespace storm {
                 static const std::string maxDepthOptionName;
                 static const std::string firstDependencyOptionName;
                 static const std::string uniqueFailedBEOptionName;
+                static const std::string parallelExplorationOptionName;
+                static const std::string modularisationThreadsOptionName;
+                static const std::string resultCacheOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
@@ -81,7 +81,8 @@ namespace storm {
                 std::shared_ptr<DFTDependency<ValueType> const> dependency = mDft.getDependency(dependencyId);
                 STORM_LOG_ASSERT(dependencyId == dependency->id(), "Ids do not match.");
                 assert(dependency->dependentEvents().size() == 1);
-                if (hasFailed(dependency->triggerEvent()->id()) && getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational) {
+                // Dependencies which were already resolved (e.g., unsuccessful PDEPs) cannot trigger again
+                if (hasFailed(dependency->triggerEvent()->id()) && getElementState(dependency->dependentEvents()[0]->id()) == DFTElementState::Operational && !dependencyTriggered(dependency->id())) {
                     failableElements.addDependency(dependency->id(), mDft.isDependencyInConflict(dependency->id()));
                     STORM_LOG_TRACE("New dependency failure: " << *dependency);
                 }
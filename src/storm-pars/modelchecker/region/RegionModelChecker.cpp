@@ -1,11 +1,16 @@
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 #include <sstream>
 #include <queue>
+#include <thread>
 
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 
+#include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -21,6 +26,23 @@
 
 namespace storm {
     namespace modelchecker {
+        
+        namespace {
+            /*!
+             * Copies the given region such that the copy does not share any memory with the given region.
+             * This is required for concurrent computations as coefficients might use reference counting which is not thread-safe (e.g., for CLN numbers).
+             */
+            template <typename ParametricType>
+            storm::storage::ParameterRegion<ParametricType> copyRegion(storm::storage::ParameterRegion<ParametricType> const& region) {
+                typedef typename storm::storage::ParameterRegion<ParametricType>::CoefficientType CoefficientType;
+                typename storm::storage::ParameterRegion<ParametricType>::Valuation lowerBoundaries, upperBoundaries;
+                for (auto const& variable : region.getVariables()) {
+                    lowerBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getLowerBoundary(variable))));
+                    upperBoundaries.emplace(variable, storm::utility::convertNumber<CoefficientType>(storm::utility::to_string(region.getUpperBoundary(variable))));
+                }
+                return storm::storage::ParameterRegion<ParametricType>(std::move(lowerBoundaries), std::move(upperBoundaries));
+            }
+        }
 
             template <typename ParametricType>
             RegionModelChecker<ParametricType>::RegionModelChecker() {
@@ -50,9 +72,33 @@ namespace storm {
             }
         
             template <typename ParametricType>
-            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis) {
+            std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::clone(Environment const&) const {
+                return nullptr;
+            }
+        
+            template <typename ParametricType>
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> RegionModelChecker<ParametricType>::performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, uint64_t numberOfThreads) {
                 STORM_LOG_INFO("Applying refinement on region: " << region.toString(true) << " .");
                 
+                // Each thread analyzes its regions with its own region model checker
+                std::vector<RegionModelChecker<ParametricType>*> checkers = {this};
+                std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> clonedCheckers;
+                for (uint64_t i = 1; i < numberOfThreads; ++i) {
+                    auto clonedChecker = clone(env);
+                    if (!clonedChecker) {
+                        STORM_LOG_WARN("The region model checker does not support concurrent region refinement. Regions are refined sequentially.");
+                        checkers.resize(1);
+                        clonedCheckers.clear();
+                        break;
+                    }
+                    checkers.push_back(clonedChecker.get());
+                    clonedCheckers.push_back(std::move(clonedChecker));
+                }
+                bool concurrent = checkers.size() > 1;
+                if (concurrent) {
+                    STORM_LOG_INFO("Refining regions with " << checkers.size() << " threads.");
+                }
+                
                 auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
                 auto areaOfParameterSpace = region.area();
                 auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
@@ -84,51 +130,101 @@ namespace storm {
                     displayedProgress = storm::utility::zero<CoefficientType>();
                 }
 
-                while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
-                    assert(unprocessedRegions.size() == refinementDepths.size());
-                    uint64_t currentDepth = refinementDepths.front();
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-                    auto& currentRegion = unprocessedRegions.front().first;
-                    auto& res = unprocessedRegions.front().second;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-                    switch (res) {
-                        case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
+                // All data above is only accessed while holding the mutex. Only the analysis of a region is done without holding the mutex.
+                std::mutex mutex;
+                std::condition_variable stateChanged;
+                uint64_t numberOfBusyThreads = 0;
+                std::exception_ptr firstException;
+                auto refine = [&] (RegionModelChecker<ParametricType>& checker) {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    while (true) {
+                        // If no region is left, we wait for the regions that are currently analyzed as they might be split
+                        stateChanged.wait(lock, [&] () { return firstException || !unprocessedRegions.empty() || numberOfBusyThreads == 0; });
+                        if (firstException || unprocessedRegions.empty() || fractionOfUndiscoveredArea <= thresholdAsCoefficient) {
                             break;
-                        default:
-                            // Split the region as long as the desired refinement depth is not reached.
-                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
-                                std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
-                                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
-                                RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
-                                                                         ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
-                                                                          RegionResult::Unknown);
-                                for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
+                        }
+                        assert(unprocessedRegions.size() == refinementDepths.size());
+                        uint64_t currentDepth = refinementDepths.front();
+                        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        auto current = std::move(unprocessedRegions.front());
+                        unprocessedRegions.pop();
+                        refinementDepths.pop();
+                        ++numOfAnalyzedRegions;
+                        auto& currentRegion = current.first;
+                        auto& res = current.second;
+                        if (concurrent) {
+                            // The regions share coefficients with their neighbors, so the region is analyzed on a copy that is only accessed by this thread
+                            auto regionCopy = copyRegion(currentRegion);
+                            ++numberOfBusyThreads;
+                            lock.unlock();
+                            try {
+                                res = checker.analyzeRegion(env, regionCopy, hypothesis, res, false);
+                            } catch (...) {
+                                lock.lock();
+                                if (!firstException) {
+                                    firstException = std::current_exception();
                                 }
-                            } else {
-                                // If the region is not further refined, it is still added to the result
-                                result.push_back(std::move(unprocessedRegions.front()));
+                                break;
                             }
-                            break;
-                    }
-                    ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
-                    if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                        while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
-                            STORM_PRINT_AND_LOG("#");
-                            displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            lock.lock();
+                            --numberOfBusyThreads;
+                        } else {
+                            res = checker.analyzeRegion(env, currentRegion, hypothesis, res, false);
+                        }
+                        switch (res) {
+                            case RegionResult::AllSat:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(current));
+                                break;
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(current));
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                             ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                              RegionResult::Unknown);
+                                    for (auto& newRegion : newRegions) {
+                                        unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
+                                        refinementDepths.push(currentDepth + 1);
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.push_back(std::move(current));
+                                }
+                                break;
                         }
+                        if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                            while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
+                                STORM_PRINT_AND_LOG("#");
+                                displayedProgress += storm::utility::convertNumber<CoefficientType>(0.01);
+                            }
+                        }
+                        stateChanged.notify_all();
+                    }
+                    stateChanged.notify_all();
+                };
+                
+                if (concurrent) {
+                    std::vector<std::thread> threads;
+                    threads.reserve(checkers.size());
+                    for (auto checker : checkers) {
+                        threads.emplace_back(refine, std::ref(*checker));
+                    }
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+                    if (firstException) {
+                        std::rethrow_exception(firstException);
                     }
+                } else {
+                    refine(*this);
                 }
                 
                 // Add the still unprocessed regions to the result
@@ -30,6 +30,12 @@ namespace storm {
             virtual bool canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask) const = 0;
             virtual void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplifications = true) = 0;
 
+            /*!
+             * Creates a new region model checker for the currently specified model and check task.
+             * The returned checker does not share any mutable data with this one and can therefore analyze regions concurrently.
+             * @return the new region model checker or nullptr if cloning is not supported by this region model checker.
+             */
+            virtual std::unique_ptr<RegionModelChecker<ParametricType>> clone(Environment const& env) const;
             
             /*!
              * Analyzes the given region.
@@ -55,9 +61,10 @@ namespace storm {
              * @param coverageThreshold if given, the refinement stops as soon as the fraction of the area of the subregions with inconclusive result is less then this threshold
              * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
              * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
+             * @param numberOfThreads if larger than one, the subregions are analyzed concurrently by clones of this region model checker.
              *
              */
-            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t numberOfThreads = 1);
             
             /*!
              * Finds the extremal value within the given region and with the given precision.
@@ -18,6 +18,7 @@
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -76,6 +77,15 @@ namespace storm {
         }
         
         
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::clone(Environment const& env) const {
+            STORM_LOG_THROW(this->parametricModel && this->currentParametricCheckTask, storm::exceptions::InvalidStateException, "Cloning a region model checker requires a specified model and check task.");
+            auto result = std::make_unique<SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+            // The considered model has already been simplified. The clone gets its own copy of the functions as it evaluates them concurrently to this model checker.
+            result->specify_internal(env, this->copyParametricModel(), *this->currentParametricCheckTask, regionSplitEstimationsEnabled, true);
+            return result;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         void SparseDtmcParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyBoundedUntilFormula(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ConstantType> const& checkTask) {
             
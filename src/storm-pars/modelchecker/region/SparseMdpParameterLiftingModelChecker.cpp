@@ -16,6 +16,7 @@
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -71,6 +72,15 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<RegionModelChecker<typename SparseModelType::ValueType>> SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::clone(Environment const& env) const {
+            STORM_LOG_THROW(this->parametricModel && this->currentParametricCheckTask, storm::exceptions::InvalidStateException, "Cloning a region model checker requires a specified model and check task.");
+            auto result = std::make_unique<SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>>();
+            // The considered model has already been simplified. The clone gets its own copy of the functions as it evaluates them concurrently to this model checker.
+            result->specify_internal(env, this->copyParametricModel(), *this->currentParametricCheckTask, false, true);
+            return result;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         void SparseMdpParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyBoundedUntilFormula(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ConstantType> const& checkTask) {
             
@@ -26,6 +26,7 @@ namespace storm {
         void SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::specifyFormula(Environment const& env, storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
 
             currentFormula = checkTask.getFormula().asSharedPointer();
+            currentParametricCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType>>(checkTask.substituteFormula(*currentFormula));
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
             
             if(currentCheckTask->getFormula().isProbabilityOperatorFormula()) {
@@ -213,6 +214,34 @@ namespace storm {
         }
 
         
+        template <typename SparseModelType, typename ConstantType>
+        std::shared_ptr<SparseModelType> SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::copyParametricModel() const {
+            auto result = std::make_shared<SparseModelType>(*parametricModel);
+            // The copy of the model still shares the functions, so they are replaced by deep copies
+            auto cache = std::make_shared<storm::RawPolynomialCache>();
+            for (auto& entry : result->getTransitionMatrix()) {
+                entry.setValue(storm::utility::parametric::deepCopy(entry.getValue(), cache));
+            }
+            for (auto& rewardModel : result->getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    for (auto& reward : rewardModel.second.getStateRewardVector()) {
+                        reward = storm::utility::parametric::deepCopy(reward, cache);
+                    }
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    for (auto& reward : rewardModel.second.getStateActionRewardVector()) {
+                        reward = storm::utility::parametric::deepCopy(reward, cache);
+                    }
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    for (auto& entry : rewardModel.second.getTransitionRewardMatrix()) {
+                        entry.setValue(storm::utility::parametric::deepCopy(entry.getValue(), cache));
+                    }
+                }
+            }
+            return result;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         SparseModelType const& SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::getConsideredParametricModel() const {
             return *parametricModel;
@@ -61,6 +61,12 @@ namespace storm {
             
         protected:
             void specifyFormula(Environment const& env, CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
+
+            /*!
+             * Copies the considered parametric model such that the copy does not share any functions with the considered model.
+             * Clones of this model checker are specified with such a copy as they evaluate the functions concurrently.
+             */
+            std::shared_ptr<SparseModelType> copyParametricModel() const;
             
             // Resets all data that correspond to the currently defined property.
             virtual void reset() = 0;
@@ -79,6 +85,8 @@ namespace storm {
             
             std::shared_ptr<SparseModelType> parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
+            // The check task as it has been specified (for the considered parametric model). Used to specify clones of this model checker.
+            std::unique_ptr<CheckTask<storm::logic::Formula, typename SparseModelType::ValueType>> currentParametricCheckTask;
 
         private:
             // store the current formula. Note that currentCheckTask only stores a reference to the formula.
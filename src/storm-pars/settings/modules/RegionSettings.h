@@ -62,6 +62,11 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently analyze regions during refinement.
+                 */
+                uint64_t getRefinementThreads() const;
+                
                 /*!
 				 * Retrieves whether an extremal value is to be computed
 				 */
@@ -102,6 +107,7 @@ namespace storm {
 				const static std::string hypothesisOptionName;
 				const static std::string hypothesisShortOptionName;
 				const static std::string refineOptionName;
+				const static std::string refinementThreadsOptionName;
 				const static std::string extremumOptionName;
 				const static std::string checkEngineOptionName;
 				const static std::string printNoIllustrationOptionName;
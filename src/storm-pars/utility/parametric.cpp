@@ -17,6 +17,21 @@ namespace storm {
         namespace parametric {
             
 #ifdef STORM_HAVE_CARL
+            namespace {
+                storm::RationalFunctionCoefficient deepCopyCoefficient(storm::RationalFunctionCoefficient const& coefficient) {
+                    // Parsing creates a number with its own memory
+                    return storm::utility::convertNumber<storm::RationalFunctionCoefficient>(storm::utility::to_string(coefficient));
+                }
+
+                storm::RawPolynomial deepCopyPolynomial(storm::RawPolynomial const& polynomial) {
+                    storm::RawPolynomial result;
+                    for (auto const& term : polynomial) {
+                        result += carl::Term<storm::RationalFunctionCoefficient>(deepCopyCoefficient(term.coeff()), term.monomial());
+                    }
+                    return result;
+                }
+            }
+
             template<>
             typename CoefficientType<storm::RationalFunction>::type evaluate<storm::RationalFunction>(storm::RationalFunction const& function, Valuation<storm::RationalFunction> const& valuation){
                 return function.evaluate(valuation);
@@ -38,6 +53,16 @@ namespace storm {
                 return storm::utility::isConstant(function.denominator()) && function.nominator().isLinear();
             }
             
+            template<>
+            storm::RationalFunction deepCopy<storm::RationalFunction>(storm::RationalFunction const& function, std::shared_ptr<storm::RawPolynomialCache> const& cache) {
+                if (function.isConstant()) {
+                    return storm::RationalFunction(deepCopyCoefficient(function.constantPart()));
+                }
+                storm::Polynomial nominator(deepCopyPolynomial(function.nominator().polynomialWithCoefficient()), cache);
+                storm::Polynomial denominator(deepCopyPolynomial(function.denominator().polynomialWithCoefficient()), cache);
+                return storm::RationalFunction(nominator, denominator);
+            }
+
             template<>
             bool isMultiLinearPolynomial<storm::RationalFunction>(storm::RationalFunction const& function) {
                 if (!storm::utility::isConstant(function.denominator())) {
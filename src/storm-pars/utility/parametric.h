@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <map>
+#include <memory>
 
 namespace storm {
     namespace utility {
@@ -60,6 +61,14 @@ namespace storm {
             template<typename FunctionType>
             bool isMultiLinearPolynomial(FunctionType const& function);
             
+            /*!
+             *  Creates a copy of the given function that does not share any memory with the given function.
+             *  Copies of functions otherwise share reference counted memory whose reference counts are not thread-safe (e.g., for CLN numbers),
+             *  so threads have to work on their own deep copies. Factorizations of the copy are stored in the given cache.
+             */
+            template<typename FunctionType>
+            FunctionType deepCopy(FunctionType const& function, std::shared_ptr<storm::RawPolynomialCache> const& cache);
+            
         }
         
     }
@@ -28,6 +28,8 @@ namespace storm {
             const std::string observationThresholdOption = "obs-threshold";
             const std::string numericPrecisionOption = "numeric-precision";
             const std::string triangulationModeOption = "triangulationmode";
+            const std::string parallelExpansionOption = "parallel-expansion";
+            const std::string incrementalCheckingOption = "incremental";
 
             BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleName) {
                 
@@ -50,6 +52,11 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, triangulationModeOption, false,"Sets how to triangulate beliefs when discretizing.").setIsAdvanced().addArgument(
                         storm::settings::ArgumentBuilder::createStringArgument("value","the triangulation mode").setDefaultValueString("dynamic").addValidatorString(storm::settings::ArgumentValidatorFactory::createMultipleChoiceValidator({"dynamic", "static"})).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, incrementalCheckingOption, false,"In refinement steps, only checks the states of the belief MDPs that can reach a changed state and uses the previous values and schedulers as hints.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExpansionOption, false,"Expands and triangulates the beliefs of the exploration frontier in parallel batches (requires Intel TBB). The resulting belief MDPs are the same as for the sequential exploration.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("batch","the number of beliefs that are expanded at once").setDefaultValueUnsignedInteger(256).makeOptional().addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
 
             bool BeliefExplorationSettings::isRefineSet() const {
@@ -133,6 +140,18 @@ namespace storm {
                 return this->getOption(triangulationModeOption).getArgumentByName("value").getValueAsString() == "static";
             }
             
+            bool BeliefExplorationSettings::isIncrementalCheckingSet() const {
+                return this->getOption(incrementalCheckingOption).getHasOptionBeenSet();
+            }
+            
+            bool BeliefExplorationSettings::isParallelExpansionSet() const {
+                return this->getOption(parallelExpansionOption).getHasOptionBeenSet();
+            }
+            
+            uint64_t BeliefExplorationSettings::getParallelExpansionBatchSize() const {
+                return this->getOption(parallelExpansionOption).getArgumentByName("batch").getValueAsUnsignedInteger();
+            }
+            
             template<typename ValueType>
             void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const {
                 options.refine = isRefineSet();
@@ -168,6 +187,8 @@ namespace storm {
                     }
                 }
                 options.dynamicTriangulation = isDynamicTriangulationModeSet();
+                options.incrementalChecking = isIncrementalCheckingSet();
+                options.parallelExpansionBatchSize = isParallelExpansionSet() ? getParallelExpansionBatchSize() : 0;
             }
             
             template void BeliefExplorationSettings::setValuesInOptionsStruct<double>(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<double>& options) const;
@@ -60,6 +60,13 @@ namespace storm {
                 
                 bool isDynamicTriangulationModeSet() const;
                 bool isStaticTriangulationModeSet() const;
+                
+                /// Controls whether refined belief MDPs are checked incrementally
+                bool isIncrementalCheckingSet() const;
+                
+                /// Controls whether (and in which batches) beliefs are expanded in parallel
+                bool isParallelExpansionSet() const;
+                uint64_t getParallelExpansionBatchSize() const;
     
                 template<typename ValueType>
                 void setValuesInOptionsStruct(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) const;
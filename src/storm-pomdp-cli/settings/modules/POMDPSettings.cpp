@@ -17,6 +17,7 @@ namespace storm {
             const std::string exportAsParametricModelOption = "parametric-drn";
             const std::string beliefExplorationOption = "belief-exploration";
             std::vector<std::string> beliefExplorationModes = {"both", "discretize", "unfold"};
+            const std::string pointBasedOption = "point-based";
             const std::string qualitativeReductionOption = "qualitativereduction";
             const std::string analyzeUniqueObservationsOption = "uniqueobservations";
             const std::string selfloopReductionOption = "selfloopreduction";
@@ -35,6 +36,7 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, memoryBoundOption, false, "Sets the maximal number of allowed memory states (1 means memoryless schedulers).").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("bound", "The maximal number of memory states.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, memoryPatternOption, false, "Sets the pattern of the considered memory structure").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "Pattern name.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(memoryPatterns)).setDefaultValueString("full").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, beliefExplorationOption, false,"Analyze the POMDP by exploring the belief state-space.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "Sets whether lower, upper, or interval result bounds are computed.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(beliefExplorationModes)).setDefaultValueString("both").makeOptional().build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, pointBasedOption, false, "Analyze the POMDP using point-based value iteration on sampled beliefs. Yields an achievable bound, i.e., a lower bound when maximizing and an upper bound when minimizing.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("beliefs", "The number of sampled beliefs.").setDefaultValueUnsignedInteger(1000).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, checkFullyObservableOption, false, "Performs standard model checking on the underlying MDP").build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, isQualitativeOption, false, "Sets the option qualitative analysis").build());
             }
@@ -77,6 +79,14 @@ namespace storm {
                 return isBeliefExplorationSet() && (arg == "unfold" || arg == "both");
             }
 
+            bool POMDPSettings::isPointBasedSet() const {
+                return this->getOption(pointBasedOption).getHasOptionBeenSet();
+            }
+
+            uint64_t POMDPSettings::getPointBasedNumberOfBeliefs() const {
+                return this->getOption(pointBasedOption).getArgumentByName("beliefs").getValueAsUnsignedInteger();
+            }
+
             bool POMDPSettings::isCheckFullyObservableSet() const {
                 return this->getOption(checkFullyObservableOption).getHasOptionBeenSet();
             }
@@ -30,6 +30,8 @@ namespace storm {
                 bool isBeliefExplorationSet() const;
                 bool isBeliefExplorationDiscretizeSet() const;
                 bool isBeliefExplorationUnfoldSet() const;
+                bool isPointBasedSet() const;
+                uint64_t getPointBasedNumberOfBeliefs() const;
                 bool isAnalyzeUniqueObservationsSet() const;
                 bool isSelfloopReductionSet() const;
                 bool isCheckFullyObservableSet() const;
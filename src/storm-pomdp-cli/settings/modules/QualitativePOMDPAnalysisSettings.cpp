@@ -25,6 +25,7 @@ namespace storm {
             const std::string preventGraphPreprocessing = "nographprocessing";
             const std::string memlessSearchOption = "memlesssearch";
             std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative"};
+            const std::string portfolioOption = "portfolio";
 
 
 
@@ -39,6 +40,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, expensiveStatsOption, true, "Compute all stats, even if this is expensive.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, printWinningRegionOption, false, "Print Winning Region").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportWinningRegionOption, false, "Export the winning region.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The name of the file to which to write the winning region.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, portfolioOption, false, "Runs several configurations of the iterative search (ranking types, deterministic schedulers, memory sizes) in parallel and stops at the first one that finds a winning scheduler for the initial states.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The maximal number of configurations that run at the same time. Use 0 for one thread per configuration.").setDefaultValueUnsignedInteger(0).makeOptional().build())
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("memory", "The largest memory bound for which configurations are added (using the memory pattern of the pomdp module).").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).makeOptional().build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, preventGraphPreprocessing, true, "Prevent graph preprocessing (for debugging)").setIsAdvanced().build());
             }
 
@@ -97,6 +101,18 @@ namespace storm {
                 return this->getOption(memlessSearchOption).getArgumentByName("method").getValueAsString();
             }
 
+            bool QualitativePOMDPAnalysisSettings::isPortfolioSet() const {
+                return this->getOption(portfolioOption).getHasOptionBeenSet();
+            }
+
+            uint64_t QualitativePOMDPAnalysisSettings::getPortfolioThreads() const {
+                return this->getOption(portfolioOption).getArgumentByName("threads").getValueAsUnsignedInteger();
+            }
+
+            uint64_t QualitativePOMDPAnalysisSettings::getPortfolioMaxMemoryBound() const {
+                return this->getOption(portfolioOption).getArgumentByName("memory").getValueAsUnsignedInteger();
+            }
+
             void QualitativePOMDPAnalysisSettings::finalize() {
             }
 
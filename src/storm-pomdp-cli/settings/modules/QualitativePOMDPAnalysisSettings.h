@@ -35,6 +35,9 @@ namespace storm {
                 bool isGraphPreprocessingAllowed() const;
                 bool isMemlessSearchSet() const;
                 std::string getMemlessSearchMethod() const;
+                bool isPortfolioSet() const;
+                uint64_t getPortfolioThreads() const;
+                uint64_t getPortfolioMaxMemoryBound() const;
 
 
 
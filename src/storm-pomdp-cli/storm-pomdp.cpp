@@ -23,8 +23,10 @@
 #include "storm-pomdp/analysis/UniqueObservationStates.h"
 #include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
 #include "storm-pomdp/modelchecker/BeliefExplorationPomdpModelChecker.h"
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
 #include "storm-pomdp/analysis/FormulaInformation.h"
 #include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/IterativePolicySearchPortfolio.h"
 #include "storm-pomdp/analysis/OneShotPolicySearch.h"
 
 #include "storm/api/storm.h"
@@ -162,7 +164,55 @@ namespace storm {
                 if (lookahead == 0) {
                     lookahead = pomdp.getNumberOfStates();
                 }
-                if (qualSettings.getMemlessSearchMethod() == "one-shot") {
+                if (qualSettings.getMemlessSearchMethod() == "iterative" && qualSettings.isPortfolioSet()) {
+                    STORM_LOG_THROW(!qualSettings.isWinningRegionSet(), storm::exceptions::NotSupportedException, "Computing winning regions is not supported by the portfolio.");
+                    auto const& pomdpSettings = storm::settings::getModule<storm::settings::modules::POMDPSettings>();
+                    typedef typename storm::pomdp::IterativePolicySearchPortfolio<ValueType>::Configuration Configuration;
+                    storm::pomdp::IterativePolicySearchPortfolio<ValueType> portfolio(smtSolverFactory);
+                    for (uint64_t memoryBound = 1; memoryBound <= qualSettings.getPortfolioMaxMemoryBound(); ++memoryBound) {
+                        Configuration base;
+                        if (memoryBound == 1) {
+                            base.pomdp = std::make_shared<storm::models::sparse::Pomdp<ValueType>>(pomdp);
+                            base.targetStates = targetStates;
+                            base.surelyReachSinkStates = surelyNotAlmostSurelyReachTarget;
+                        } else {
+                            storm::storage::PomdpMemory memory = storm::storage::PomdpMemoryBuilder().build(pomdpSettings.getMemoryPattern(), memoryBound);
+                            base.pomdp = storm::transformer::PomdpMemoryUnfolder<ValueType>(*origpomdp, memory).transform();
+                            storm::analysis::QualitativeAnalysisOnGraphs<ValueType> unfoldedAnalysis(*base.pomdp);
+                            base.surelyReachSinkStates = unfoldedAnalysis.analyseProbSmaller1(formula.asProbabilityOperatorFormula());
+                            base.pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(base.surelyReachSinkStates);
+                            base.targetStates = unfoldedAnalysis.analyseProb1(formula.asProbabilityOperatorFormula());
+                        }
+                        base.lookahead = qualSettings.getLookahead() == 0 ? base.pomdp->getNumberOfStates() : qualSettings.getLookahead();
+                        base.options = options;
+                        std::string memoryName = "memory " + std::to_string(memoryBound);
+
+                        Configuration configuration = base;
+                        configuration.name = memoryName + ", default";
+                        portfolio.addConfiguration(configuration);
+                        for (auto const& pathVariableType : {storm::pomdp::MemlessSearchPathVariables::RealRanking, storm::pomdp::MemlessSearchPathVariables::IntegerRanking}) {
+                            if (pathVariableType != options.pathVariableType) {
+                                configuration = base;
+                                configuration.options.pathVariableType = pathVariableType;
+                                configuration.name = memoryName + (pathVariableType == storm::pomdp::MemlessSearchPathVariables::RealRanking ? ", real ranking" : ", integer ranking");
+                                portfolio.addConfiguration(configuration);
+                            }
+                        }
+                        if (!options.onlyDeterministicStrategies) {
+                            configuration = base;
+                            configuration.options.onlyDeterministicStrategies = true;
+                            configuration.name = memoryName + ", deterministic";
+                            portfolio.addConfiguration(configuration);
+                        }
+                    }
+                    STORM_PRINT_AND_LOG("Running " << portfolio.getConfigurations().size() << " search configurations in parallel." << std::endl);
+                    auto result = portfolio.analyzeForInitialStates(qualSettings.getPortfolioThreads());
+                    if (result.initialStatesWinning) {
+                        STORM_PRINT_AND_LOG("From initial state, one can almost-surely reach the target (found by configuration '" << portfolio.getConfigurations()[result.winningConfiguration.get()].name << "')." << std::endl);
+                    } else {
+                        STORM_PRINT_AND_LOG("From initial state, one may not almost-surely reach the target." << std::endl);
+                    }
+                } else if (qualSettings.getMemlessSearchMethod() == "one-shot") {
                     storm::pomdp::OneShotPolicySearch<ValueType> memlessSearch(pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory);
                     if (qualSettings.isWinningRegionSet()) {
                         STORM_LOG_ERROR("Computing winning regions is not supported by ccd-memless.");
@@ -240,6 +290,26 @@ namespace storm {
                     STORM_PRINT_AND_LOG(std::endl);
                     analysisPerformed = true;
                 }
+                if (pomdpSettings.isPointBasedSet()) {
+                    STORM_PRINT_AND_LOG("Running point-based value iteration... ");
+                    storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options;
+                    options.numberOfBeliefs = pomdpSettings.getPointBasedNumberOfBeliefs();
+                    storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(pomdp, options);
+                    auto result = checker.check(formula);
+                    STORM_PRINT_AND_LOG("\n# sampled beliefs: " << result.numberOfBeliefs << ", # alpha vectors: " << result.numberOfAlphaVectors << ", # iterations: " << result.numberOfIterations);
+                    if (storm::utility::resources::isTerminate()) {
+                        STORM_PRINT_AND_LOG("\nResult till abort: ")
+                    } else {
+                        STORM_PRINT_AND_LOG("\nResult: ")
+                    }
+                    if (result.isLowerBound) {
+                        printResult(result.bound, storm::utility::infinity<ValueType>());
+                    } else {
+                        printResult(-storm::utility::infinity<ValueType>(), result.bound);
+                    }
+                    STORM_PRINT_AND_LOG(std::endl);
+                    analysisPerformed = true;
+                }
                 if (pomdpSettings.isQualitativeAnalysisSet()) {
                     performQualitativeAnalysis(pomdp, formulaInfo, formula);
                     analysisPerformed = true;
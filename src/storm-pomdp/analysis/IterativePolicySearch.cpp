@@ -45,6 +45,7 @@ namespace storm {
             STORM_PRINT_AND_LOG("Update solver with new scheduler time: " << updateNewStrategySolverTime);
             STORM_PRINT_AND_LOG("Winning regions update time: " << winningRegionUpdatesTimer);
             STORM_PRINT_AND_LOG("Graph search time: " << graphSearchTime);
+            STORM_PRINT_AND_LOG("Incremental solver restarts: " << incrementalRestarts);
         }
 
         template <typename ValueType>
@@ -96,6 +97,23 @@ namespace storm {
                 k = 10; //magic constant, consider moving.
             }
 
+            // Drop all constraints that depend on the current winning region.
+            popSolverScopes();
+            if (baseConstraintsEncoded && !options.incrementalEncoding) {
+                smtSolver->reset();
+                baseConstraintsEncoded = false;
+            } else if (baseConstraintsEncoded && (lookaheadConstraintsRequired != encodedLookahead || (lookaheadConstraintsRequired && k != encodedK))) {
+                STORM_LOG_INFO("Lookahead changed, encoding the problem from scratch.");
+                smtSolver->reset();
+                baseConstraintsEncoded = false;
+            }
+            if (baseConstraintsEncoded) {
+                // The encoding of the POMDP (and everything the solver learned from it) is kept.
+                stats.incrementIncrementalRestarts();
+                encodeTargetStates();
+                return lookaheadConstraintsRequired;
+            }
+
 
             if (actionSelectionVars.empty()) {
 
@@ -111,6 +129,8 @@ namespace storm {
                     continuationVars.push_back(
                             expressionManager->declareBooleanVariable("D-" + std::to_string(stateId)));
                     continuationVarExpressions.push_back(continuationVars.back().getExpression());
+                    targetVars.push_back(expressionManager->declareBooleanVariable("T-" + std::to_string(stateId)));
+                    targetVarExpressions.push_back(targetVars.back().getExpression());
                 }
                 // Create the action selection variables.
                 uint64_t obs = 0;
@@ -213,11 +233,8 @@ namespace storm {
             if (lookaheadConstraintsRequired) {
                 if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
                     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                        if (targetStates.get(state)) {
-                            smtSolver->add(pathVarExpressions[state][0]);
-                        } else {
-                            smtSolver->add(!pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
-                        }
+                        smtSolver->add(!targetVarExpressions[state] || pathVarExpressions[state][0]);
+                        smtSolver->add(targetVarExpressions[state] || !pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
                     }
                 } else {
                    for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
@@ -231,15 +248,19 @@ namespace storm {
             }
 
             // PAPER COMMENT: 4
+            // All constraints that only apply to non-target states are guarded by the target variable of the state.
+            // This way, the encoding can be kept if further states become target states.
             uint64_t rowindex = 0;
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                if (targetStates.get(state) || surelyReachSinkStates.get(state)) {
+                if (surelyReachSinkStates.get(state)) {
                     rowindex += pomdp.getNumberOfChoices(state);
                     continue;
                 }
                 for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
                     std::vector<storm::expressions::Expression> subexprreachSwitch;
                     std::vector<storm::expressions::Expression> subexprreachNoSwitch;
+                    subexprreachSwitch.push_back(targetVarExpressions[state]);
+                    subexprreachNoSwitch.push_back(targetVarExpressions[state]);
                     subexprreachSwitch.push_back(!reachVarExpressions[state]);
                     subexprreachSwitch.push_back(!actionSelectionVarExpressions[pomdp.getObservation(state)][action]);
                     subexprreachSwitch.push_back(!switchVarExpressions[pomdp.getObservation(state)]);
@@ -267,12 +288,13 @@ namespace storm {
 
 
 
-            rowindex = 0;
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                rowindex = pomdp.getTransitionMatrix().getRowGroupIndices()[state];
                 // PAPER COMMENT 5
                 if (surelyReachSinkStates.get(state)) {
                     smtSolver->add(!reachVarExpressions[state]);
                     smtSolver->add(!continuationVarExpressions[state]);
+                    smtSolver->add(!targetVarExpressions[state]);
                     if (lookaheadConstraintsRequired) {
                         if(options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
                             for (uint64_t j = 1; j < k; ++j) {
@@ -282,89 +304,83 @@ namespace storm {
                             smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(k));
                         }
                     }
-                    rowindex += pomdp.getNumberOfChoices(state);
-                } else if(!targetStates.get(state)) {
-                    if (lookaheadConstraintsRequired) {
-
-
-                        if(options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                            // PAPER COMMENT 6
-                            smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state),
-                                                                           pathVarExpressions.at(state).back()));
-                            // PAPER COMMENT 7
-
-                            std::vector<std::vector<std::vector<storm::expressions::Expression>>> pathsubsubexprs;
-                            for (uint64_t j = 1; j < k; ++j) {
-                                pathsubsubexprs.push_back(std::vector<std::vector<storm::expressions::Expression>>());
-                                for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                                    pathsubsubexprs.back().push_back(std::vector<storm::expressions::Expression>());
-                                }
+                    continue;
+                }
+                // Constraints for non-target states
+                if (lookaheadConstraintsRequired) {
+                    if(options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                        // PAPER COMMENT 6
+                        smtSolver->add(targetVarExpressions[state] || storm::expressions::implies(reachVarExpressions.at(state),
+                                                                                                   pathVarExpressions.at(state).back()));
+                        // PAPER COMMENT 7
+
+                        std::vector<std::vector<std::vector<storm::expressions::Expression>>> pathsubsubexprs;
+                        for (uint64_t j = 1; j < k; ++j) {
+                            pathsubsubexprs.push_back(std::vector<std::vector<storm::expressions::Expression>>());
+                            for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                                pathsubsubexprs.back().push_back(std::vector<storm::expressions::Expression>());
                             }
+                        }
 
-                            for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                                std::vector<storm::expressions::Expression> subexprreach;
-                                for (auto const &entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                                    for (uint64_t j = 1; j < k; ++j) {
-                                        pathsubsubexprs[j - 1][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
-                                    }
+                        for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                            for (auto const &entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
+                                for (uint64_t j = 1; j < k; ++j) {
+                                    pathsubsubexprs[j - 1][action].push_back(pathVarExpressions[entries.getColumn()][j - 1]);
                                 }
-                                rowindex++;
                             }
+                            rowindex++;
+                        }
 
-                            for (uint64_t j = 1; j < k; ++j) {
-                                std::vector<storm::expressions::Expression> pathsubexprs;
-
-                                for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                                    pathsubexprs.push_back(actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action) && storm::expressions::disjunction(pathsubsubexprs[j - 1][action]));
-                                }
-                                pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
-                                pathsubexprs.push_back(followVarExpressions[pomdp.getObservation(state)]);
-                                smtSolver->add(storm::expressions::iff(pathVarExpressions[state][j],
-                                                                           storm::expressions::disjunction(pathsubexprs)));
+                        for (uint64_t j = 1; j < k; ++j) {
+                            std::vector<storm::expressions::Expression> pathsubexprs;
 
+                            for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                                pathsubexprs.push_back(actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action) && storm::expressions::disjunction(pathsubsubexprs[j - 1][action]));
                             }
-                        } else {
+                            pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
+                            pathsubexprs.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                            smtSolver->add(targetVarExpressions[state] || storm::expressions::iff(pathVarExpressions[state][j],
+                                                                                                   storm::expressions::disjunction(pathsubexprs)));
 
-                            std::vector<storm::expressions::Expression> actPathDisjunction;
-                            for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
-                                std::vector<storm::expressions::Expression> pathDisjunction;
-                                for (auto const &entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
-                                    pathDisjunction.push_back(pathVarExpressions[entries.getColumn()][0] < pathVarExpressions[state][0]);
-                                }
-                                actPathDisjunction.push_back(storm::expressions::disjunction(pathDisjunction) && actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action));
-                                rowindex++;
+                        }
+                    } else {
+
+                        std::vector<storm::expressions::Expression> actPathDisjunction;
+                        for (uint64_t action = 0; action < pomdp.getNumberOfChoices(state); ++action) {
+                            std::vector<storm::expressions::Expression> pathDisjunction;
+                            for (auto const &entries : pomdp.getTransitionMatrix().getRow(rowindex)) {
+                                pathDisjunction.push_back(pathVarExpressions[entries.getColumn()][0] < pathVarExpressions[state][0]);
                             }
-                            // TODO reconsider if this next add is sound
-                            actPathDisjunction.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
-                            actPathDisjunction.push_back(followVarExpressions[pomdp.getObservation(state)]);
-                            actPathDisjunction.push_back(!reachVarExpressions[state]);
-                            smtSolver->add(storm::expressions::disjunction(actPathDisjunction));
+                            actPathDisjunction.push_back(storm::expressions::disjunction(pathDisjunction) && actionSelectionVarExpressions.at(pomdp.getObservation(state)).at(action));
+                            rowindex++;
                         }
+                        // TODO reconsider if this next add is sound
+                        actPathDisjunction.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
+                        actPathDisjunction.push_back(followVarExpressions[pomdp.getObservation(state)]);
+                        actPathDisjunction.push_back(!reachVarExpressions[state]);
+                        actPathDisjunction.push_back(targetVarExpressions[state]);
+                        smtSolver->add(storm::expressions::disjunction(actPathDisjunction));
                     }
-                } else {
-                    if (lookaheadConstraintsRequired) {
-                        if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
-                            for (uint64_t j = 1; j < k; ++j) {
-                                smtSolver->add(pathVarExpressions[state][j]);
-                            }
-                        } else {
-                            smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(0));
-                            //assert(false);
+                }
+                // Constraints for target states
+                if (lookaheadConstraintsRequired) {
+                    if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
+                        for (uint64_t j = 1; j < k; ++j) {
+                            smtSolver->add(!targetVarExpressions[state] || pathVarExpressions[state][j]);
                         }
+                    } else {
+                        smtSolver->add(!targetVarExpressions[state] || pathVarExpressions[state][0] == expressionManager->integer(0));
                     }
-                    smtSolver->add(reachVars[state]);
-                    rowindex += pomdp.getNumberOfChoices(state);
                 }
+                smtSolver->add(!targetVarExpressions[state] || reachVarExpressions[state]);
             }
 
             // PAPER COMMENT 8
             obs = 0;
             for(auto const& statesForObservation : statesPerObservation) {
                 for(auto const& state : statesForObservation) {
-                    if (!targetStates.get(state)) {
-                        smtSolver->add(!continuationVars[state] || schedulerVariableExpressions[obs] > 0);
-                        smtSolver->add(!reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
-                    }
+                    smtSolver->add(targetVarExpressions[state] || !continuationVars[state] || schedulerVariableExpressions[obs] > 0);
+                    smtSolver->add(targetVarExpressions[state] || !reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
                 }
                 ++obs;
             }
@@ -373,9 +389,45 @@ namespace storm {
             for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                 smtSolver->add(storm::expressions::implies(switchVarExpressions[obs], storm::expressions::disjunction(reachVarExpressionsPerObservation[obs])));
             }
+            baseConstraintsEncoded = true;
+            encodedLookahead = lookaheadConstraintsRequired;
+            encodedK = k;
+
+            encodeTargetStates();
             return lookaheadConstraintsRequired;
         }
 
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::encodeTargetStates() {
+            pushSolverScope();
+            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                if (!surelyReachSinkStates.get(state)) {
+                    smtSolver->add(targetStates.get(state) ? targetVarExpressions[state] : !targetVarExpressions[state]);
+                }
+            }
+        }
+
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::pushSolverScope() {
+            smtSolver->push();
+            ++solverScopes;
+        }
+
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::popSolverScope() {
+            STORM_LOG_ASSERT(solverScopes > 0, "No solver scope to pop.");
+            smtSolver->pop();
+            --solverScopes;
+        }
+
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::popSolverScopes() {
+            if (solverScopes > 0) {
+                smtSolver->pop(solverScopes);
+                solverScopes = 0;
+            }
+        }
+
         template<typename ValueType>
         uint64_t IterativePolicySearch<ValueType>::getOffsetFromObservation(uint64_t state, uint64_t observation) const {
             if(!useFindOffset) {
@@ -518,7 +570,7 @@ namespace storm {
 
             }
 
-            smtSolver->push();
+            pushSolverScope();
             for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                 auto constant = expressionManager->integer(schedulerForObs[obs]);
                 smtSolver->add(schedulerVariableExpressions[obs] <= constant);
@@ -694,7 +746,7 @@ namespace storm {
                     break;
                 }
                 //smtSolver->unsetTimeout();
-                smtSolver->pop();
+                popSolverScope();
 
                 if(options.computeDebugOutput()) {
                     printCoveredStates(~coveredStates);
@@ -847,7 +899,7 @@ namespace storm {
                 }
                 finalSchedulers.push_back(scheduler);
 
-                smtSolver->push();
+                pushSolverScope();
 
                 for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                     if(winningRegion.observationIsWinning(obs)) {
@@ -922,8 +974,23 @@ namespace storm {
             return stats;
         }
 
+        template<typename ValueType>
+        void IterativePolicySearch<ValueType>::abort() {
+            aborted = true;
+            smtSolver->interrupt();
+        }
+
+        template<typename ValueType>
+        bool IterativePolicySearch<ValueType>::isAborted() const {
+            return aborted;
+        }
+
         template <typename ValueType>
         bool IterativePolicySearch<ValueType>::smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions) {
+            if (isAborted()) {
+                STORM_LOG_DEBUG("Search aborted.");
+                return false;
+            }
             if(options.isExportSATSet()) {
                 STORM_LOG_DEBUG("Export SMT Solver Call (" <<iteration << ")");
                 std::string filepath = options.getExportSATCallsPath() + "call_" + std::to_string(iteration) + ".smt2";
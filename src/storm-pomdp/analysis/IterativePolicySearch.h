@@ -1,5 +1,6 @@
 #include <vector>
 #include <sstream>
+#include <atomic>
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/solver/SmtSolver.h"
 #include "storm/models/sparse/Pomdp.h"
@@ -16,7 +17,7 @@ namespace pomdp {
     enum class MemlessSearchPathVariables {
         BooleanRanking, IntegerRanking, RealRanking
     };
-    MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+    inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
         if(in == "int") {
             return MemlessSearchPathVariables::IntegerRanking;
         } else if (in == "real") {
@@ -66,6 +67,8 @@ namespace pomdp {
         uint64_t restartAfterNIterations = 250;
         uint64_t extensionCallTimeout = 0u;
         uint64_t localIterationMaximum = 600;
+        // If not set, the solver is reset and the encoding is rebuilt on every restart.
+        bool incrementalEncoding = true;
 
     private:
         std::string exportSATcalls = "";
@@ -156,10 +159,15 @@ namespace pomdp {
                 void incrementGraphBasedWinningObservations() {
                     graphBasedAnalysisWinOb++;
                 }
+
+                void incrementIncrementalRestarts() {
+                    incrementalRestarts++;
+                }
         private:
                 uint64_t satCalls = 0;
                 uint64_t outerIterations = 0;
                 uint64_t graphBasedAnalysisWinOb = 0;
+                uint64_t incrementalRestarts = 0;
         };
 
         IterativePolicySearch(storm::models::sparse::Pomdp<ValueType> const& pomdp,
@@ -203,6 +211,14 @@ namespace pomdp {
 
         Statistics const& getStatistics() const;
         void finalizeStatistics();
+
+        /*!
+         * Requests that a running analysis stops as soon as possible. May be called from a different thread.
+         * A running solver query is interrupted if the SMT solver supports this. Otherwise, the analysis stops
+         * before its next query. The winning region obtained so far remains valid.
+         */
+        void abort();
+        bool isAborted() const;
     private:
         storm::expressions::Expression const& getDoneActionExpression(uint64_t obs) const;
 
@@ -210,10 +226,18 @@ namespace pomdp {
             STORM_LOG_INFO("Reset solver to restart with current winning region");
             schedulerForObs.clear();
             finalSchedulers.clear();
-            smtSolver->reset();
-
-
+            // Only the constraints that depend on the winning region are dropped.
+            // The encoding of the POMDP is kept, including what the solver learned from it.
+            popSolverScopes();
         }
+
+        /*!
+         * Pushes a solver scope that fixes which states are currently considered as target states.
+         */
+        void encodeTargetStates();
+        void pushSolverScope();
+        void popSolverScope();
+        void popSolverScopes();
         void printScheduler(std::vector<InternalObservationScheduler> const& );
         void printCoveredStates(storm::storage::BitVector const& remaining) const;
 
@@ -251,6 +275,14 @@ namespace pomdp {
         std::vector<storm::expressions::Expression> continuationVarExpressions;
         std::vector<std::vector<storm::expressions::Variable>> pathVars;
         std::vector<std::vector<storm::expressions::Expression>> pathVarExpressions;
+        std::vector<storm::expressions::Variable> targetVars;
+        std::vector<storm::expressions::Expression> targetVarExpressions;
+
+        bool baseConstraintsEncoded = false;
+        bool encodedLookahead = false;
+        uint64_t encodedK = 0;
+        uint64_t solverScopes = 0;
+        std::atomic<bool> aborted{false};
 
         std::vector<InternalObservationScheduler> finalSchedulers;
         std::vector<uint64_t> schedulerForObs;
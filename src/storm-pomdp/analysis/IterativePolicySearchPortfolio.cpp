@@ -0,0 +1,116 @@
+#include "storm-pomdp/analysis/IterativePolicySearchPortfolio.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace pomdp {
+
+        template<typename ValueType>
+        IterativePolicySearchPortfolio<ValueType>::IterativePolicySearchPortfolio(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory) : smtSolverFactory(smtSolverFactory) {
+            // Intentionally left empty
+        }
+
+        template<typename ValueType>
+        void IterativePolicySearchPortfolio<ValueType>::addConfiguration(Configuration const& configuration) {
+            STORM_LOG_THROW(configuration.pomdp, storm::exceptions::InvalidArgumentException, "No POMDP given for configuration '" << configuration.name << "'.");
+            configurations.push_back(configuration);
+        }
+
+        template<typename ValueType>
+        std::vector<typename IterativePolicySearchPortfolio<ValueType>::Configuration> const& IterativePolicySearchPortfolio<ValueType>::getConfigurations() const {
+            return configurations;
+        }
+
+        template<typename ValueType>
+        typename IterativePolicySearchPortfolio<ValueType>::Result IterativePolicySearchPortfolio<ValueType>::analyzeForInitialStates(uint64_t numberOfThreads) {
+            STORM_LOG_THROW(!configurations.empty(), storm::exceptions::InvalidArgumentException, "The portfolio does not contain any configurations.");
+            if (numberOfThreads == 0 || numberOfThreads > configurations.size()) {
+                numberOfThreads = configurations.size();
+            }
+
+            Result result;
+            std::atomic<uint64_t> nextConfiguration(0);
+            std::atomic<bool> done(false);
+            std::mutex mutex;
+            std::vector<IterativePolicySearch<ValueType>*> runningSearches;
+            std::exception_ptr firstException;
+
+            // Aborts all running searches. Assumes that the mutex is locked.
+            auto abortAll = [&done, &runningSearches]() {
+                done = true;
+                for (auto* search : runningSearches) {
+                    search->abort();
+                }
+            };
+
+            auto worker = [&]() {
+                while (!done) {
+                    uint64_t index = nextConfiguration++;
+                    if (index >= configurations.size()) {
+                        return;
+                    }
+                    auto const& configuration = configurations[index];
+                    std::unique_ptr<IterativePolicySearch<ValueType>> search;
+                    bool winning = false;
+                    try {
+                        search = std::make_unique<IterativePolicySearch<ValueType>>(*configuration.pomdp, configuration.targetStates, configuration.surelyReachSinkStates, smtSolverFactory, configuration.options);
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (done) {
+                                return;
+                            }
+                            runningSearches.push_back(search.get());
+                        }
+                        STORM_LOG_INFO("Starting policy search configuration '" << configuration.name << "'.");
+                        winning = search->analyze(configuration.lookahead, ~configuration.surelyReachSinkStates & ~configuration.targetStates, configuration.pomdp->getInitialStates());
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        runningSearches.erase(std::remove(runningSearches.begin(), runningSearches.end(), search.get()), runningSearches.end());
+                        if (!firstException) {
+                            firstException = std::current_exception();
+                        }
+                        abortAll();
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    runningSearches.erase(std::remove(runningSearches.begin(), runningSearches.end(), search.get()), runningSearches.end());
+                    // The winning region is sound even if the search has been aborted.
+                    if (winning && !done) {
+                        STORM_LOG_INFO("Policy search configuration '" << configuration.name << "' found a winning policy for the initial states.");
+                        result.initialStatesWinning = true;
+                        result.winningConfiguration = index;
+                        result.winningRegion = search->getLastWinningRegion();
+                        abortAll();
+                    } else {
+                        STORM_LOG_INFO("Policy search configuration '" << configuration.name << "' finished without a winning policy for the initial states.");
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(numberOfThreads);
+            for (uint64_t i = 0; i < numberOfThreads; ++i) {
+                threads.emplace_back(worker);
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            if (firstException) {
+                std::rethrow_exception(firstException);
+            }
+            return result;
+        }
+
+        template class IterativePolicySearchPortfolio<double>;
+        template class IterativePolicySearchPortfolio<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/solver.h"
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+
+namespace storm {
+namespace pomdp {
+
+    /*!
+     * Runs several configurations of the iterative policy search in parallel threads.
+     * As soon as one configuration shows that the target can be reached almost-surely from the initial states, the remaining ones are aborted.
+     */
+    template<typename ValueType>
+    class IterativePolicySearchPortfolio {
+    public:
+        struct Configuration {
+            std::string name;
+            // Configurations may consider different POMDPs, e.g., unfoldings with different memory sizes.
+            std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> pomdp;
+            storm::storage::BitVector targetStates;
+            storm::storage::BitVector surelyReachSinkStates;
+            MemlessSearchOptions options;
+            uint64_t lookahead;
+        };
+
+        struct Result {
+            bool initialStatesWinning = false;
+            boost::optional<uint64_t> winningConfiguration;
+            // The winning region computed by the winning configuration (if any).
+            boost::optional<WinningRegion> winningRegion;
+        };
+
+        IterativePolicySearchPortfolio(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory);
+
+        void addConfiguration(Configuration const& configuration);
+
+        std::vector<Configuration> const& getConfigurations() const;
+
+        /*!
+         * Runs the configurations.
+         * @param numberOfThreads the maximal number of configurations that run at the same time. 0 means one thread per configuration.
+         */
+        Result analyzeForInitialStates(uint64_t numberOfThreads = 0);
+
+    private:
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory;
+        std::vector<Configuration> configurations;
+    };
+}
+}
@@ -9,7 +9,9 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.cpp"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/Scheduler.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
 
@@ -28,7 +30,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds, bool incrementalChecking) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), incrementalChecking(incrementalChecking), hasCheckedValues(false), status(Status::Uninitialized) {
             // Intentionally left empty
         }
 
@@ -50,6 +52,9 @@ namespace storm {
             lowerValueBounds.clear();
             upperValueBounds.clear();
             values.clear();
+            hasCheckedValues = false;
+            changedMdpStates = boost::none;
+            schedulerChoices.clear();
             exploredMdpTransitions.clear();
             exploredChoiceIndices.clear();
             mdpActionRewards.clear();
@@ -151,6 +156,17 @@ namespace storm {
             return mdpStateToBeliefIdMap[currentMdpState];
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefIdsToExplore(uint64_t maxNumberOfBeliefs) const {
+            STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+            std::vector<BeliefId> result;
+            result.reserve(std::min<uint64_t>(maxNumberOfBeliefs, mdpStatesToExplore.size()));
+            for (auto stateIt = mdpStatesToExplore.begin(); stateIt != mdpStatesToExplore.end() && result.size() < maxNumberOfBeliefs; ++stateIt) {
+                result.push_back(mdpStateToBeliefIdMap[*stateIt]);
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                         ValueType const &bottomStateValue) {
@@ -337,6 +353,12 @@ namespace storm {
             // We are not exploring anymore
             currentMdpState = noState();
 
+            // Find out which states need to be checked again (before the state indices are changed below).
+            changedMdpStates = boost::none;
+            if (incrementalChecking && exploredMdp && hasCheckedValues) {
+                changedMdpStates = computeChangedMdpStates();
+            }
+
             // If this was a restarted exploration, we might still have unexplored states (which were only reachable and explored in a previous build).
             // We get rid of these before rebuilding the model
             if (exploredMdp) {
@@ -499,9 +521,52 @@ namespace storm {
             storm::utility::vector::filterVectorInPlace(lowerValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(upperValueBounds, relevantMdpStates);
             storm::utility::vector::filterVectorInPlace(values, relevantMdpStates);
+            if (changedMdpStates) {
+                changedMdpStates = changedMdpStates.get() % relevantMdpStates;
+            }
+            if (!schedulerChoices.empty()) {
+                schedulerChoices.resize(relevantMdpStates.size(), 0);
+                storm::utility::vector::filterVectorInPlace(schedulerChoices, relevantMdpStates);
+            }
 
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        storm::storage::BitVector BeliefMdpExplorer<PomdpType, BeliefValueType>::computeChangedMdpStates() const {
+            STORM_LOG_ASSERT(exploredMdp, "Method called although no 'old' MDP is available.");
+            storm::storage::BitVector result(getCurrentNumberOfMdpStates(), true);
+            auto const &oldTransitions = exploredMdp->getTransitionMatrix();
+            auto const &oldTargetStates = exploredMdp->getStates("target");
+            // The old states keep their indices (and their choice indices) during exploration.
+            for (MdpStateType state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+                if (targetStates.get(state) != oldTargetStates.get(state)) {
+                    continue;
+                }
+                bool changed = false;
+                for (uint64_t row = exploredChoiceIndices[state]; !changed && row < exploredChoiceIndices[state + 1]; ++row) {
+                    auto const &oldRow = oldTransitions.getRow(row);
+                    auto const &newRow = exploredMdpTransitions[row];
+                    if (oldRow.getNumberOfEntries() != newRow.size()) {
+                        changed = true;
+                        break;
+                    }
+                    auto newEntryIt = newRow.begin();
+                    for (auto const &oldEntry : oldRow) {
+                        if (oldEntry.getColumn() != newEntryIt->first || oldEntry.getValue() != newEntryIt->second) {
+                            changed = true;
+                            break;
+                        }
+                        ++newEntryIt;
+                    }
+                    if (exploredMdp->hasRewardModel() && exploredMdp->getUniqueRewardModel().getStateActionReward(row) != mdpActionRewards[row]) {
+                        changed = true;
+                    }
+                }
+                result.set(state, changed);
+            }
+            return result;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         std::shared_ptr<storm::models::sparse::Mdp<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>>
         BeliefMdpExplorer<PomdpType, BeliefValueType>::getExploredMdp() const {
@@ -568,12 +633,32 @@ namespace storm {
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir) {
             STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
             STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
+            if (changedMdpStates) {
+                // Only the states that can reach a changed state need to be checked again.
+                storm::storage::BitVector affectedStates = storm::utility::graph::performProbGreater0E(exploredMdp->getBackwardTransitions(), storm::storage::BitVector(exploredMdp->getNumberOfStates(), true), changedMdpStates.get());
+                changedMdpStates = boost::none;
+                // If most states are affected, checking the whole MDP is cheaper than building the sub-MDP.
+                if (affectedStates.getNumberOfSetBits() * 2 <= exploredMdp->getNumberOfStates() && computeValuesOfAffectedMdpStates(dir, affectedStates)) {
+                    STORM_LOG_INFO("Checked " << affectedStates.getNumberOfSetBits() << " of the " << exploredMdp->getNumberOfStates() << " states of the explored MDP that are affected by the refinement.");
+                    status = Status::ModelChecked;
+                    return;
+                }
+            }
+
             auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
-            auto task = createStandardCheckTask(property);
+            auto task = createStandardCheckTask(property, values, schedulerChoices);
 
             std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(exploredMdp, task));
+            hasCheckedValues = static_cast<bool>(res);
             if (res) {
-                values = std::move(res->asExplicitQuantitativeCheckResult<ValueType>().getValueVector());
+                auto &quantitativeResult = res->asExplicitQuantitativeCheckResult<ValueType>();
+                if (quantitativeResult.hasScheduler()) {
+                    schedulerChoices.resize(exploredMdp->getNumberOfStates());
+                    for (uint64_t state = 0; state < exploredMdp->getNumberOfStates(); ++state) {
+                        schedulerChoices[state] = quantitativeResult.getScheduler().getChoice(state).getDeterministicChoice();
+                    }
+                }
+                values = std::move(quantitativeResult.getValueVector());
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(lowerValueBounds, values, std::less_equal<ValueType>()),
                                           "Computed values are smaller than the lower bound.");
                 STORM_LOG_WARN_COND_DEBUG(storm::utility::vector::compareElementWise(upperValueBounds, values, std::greater_equal<ValueType>()),
@@ -585,6 +670,115 @@ namespace storm {
             status = Status::ModelChecked;
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        bool BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfAffectedMdpStates(storm::solver::OptimizationDirection const &dir, storm::storage::BitVector const &affectedStates) {
+            if (affectedStates.empty()) {
+                // Nothing changed, so the values remain valid.
+                return true;
+            }
+            bool const computeRewards = exploredMdp->hasRewardModel();
+            auto const &transitions = exploredMdp->getTransitionMatrix();
+            auto const &choiceIndices = transitions.getRowGroupIndices();
+            uint64_t const numberOfSubStates = affectedStates.getNumberOfSetBits() + 2;
+            uint64_t const subTargetState = numberOfSubStates - 2;
+            uint64_t const subBottomState = numberOfSubStates - 1;
+            auto toSubStateMap = affectedStates.getNumberOfSetBitsBeforeIndices();
+
+            // Transitions to unaffected states are redirected to the extra target and bottom states, weighted with the value of the unaffected state.
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfSubStates, 0, true, true, numberOfSubStates);
+            std::vector<ValueType> subActionRewards;
+            std::vector<ValueType> subValues;
+            std::vector<uint64_t> subSchedulerChoices;
+            uint64_t subRow = 0;
+            for (auto const &state : affectedStates) {
+                builder.newRowGroup(subRow);
+                subValues.push_back(values[state]);
+                if (!schedulerChoices.empty()) {
+                    subSchedulerChoices.push_back(state < schedulerChoices.size() ? schedulerChoices[state] : 0);
+                }
+                for (uint64_t row = choiceIndices[state]; row < choiceIndices[state + 1]; ++row, ++subRow) {
+                    ValueType targetProbability = storm::utility::zero<ValueType>();
+                    ValueType bottomProbability = storm::utility::zero<ValueType>();
+                    ValueType reward = computeRewards ? exploredMdp->getUniqueRewardModel().getStateActionReward(row) : storm::utility::zero<ValueType>();
+                    for (auto const &entry : transitions.getRow(row)) {
+                        if (affectedStates.get(entry.getColumn())) {
+                            builder.addNextValue(subRow, toSubStateMap[entry.getColumn()], entry.getValue());
+                        } else if (computeRewards) {
+                            if (storm::utility::isInfinity(values[entry.getColumn()])) {
+                                return false;
+                            }
+                            targetProbability += entry.getValue();
+                            reward += entry.getValue() * values[entry.getColumn()];
+                        } else {
+                            ValueType value = std::min(std::max(values[entry.getColumn()], storm::utility::zero<ValueType>()), storm::utility::one<ValueType>());
+                            targetProbability += entry.getValue() * value;
+                            bottomProbability += entry.getValue() * (storm::utility::one<ValueType>() - value);
+                        }
+                    }
+                    if (!storm::utility::isZero(targetProbability)) {
+                        builder.addNextValue(subRow, subTargetState, targetProbability);
+                    }
+                    if (!storm::utility::isZero(bottomProbability)) {
+                        builder.addNextValue(subRow, subBottomState, bottomProbability);
+                    }
+                    if (computeRewards) {
+                        subActionRewards.push_back(std::move(reward));
+                    }
+                }
+            }
+            for (auto const &extraState : {subTargetState, subBottomState}) {
+                builder.newRowGroup(subRow);
+                builder.addNextValue(subRow, extraState, storm::utility::one<ValueType>());
+                ++subRow;
+                if (computeRewards) {
+                    subActionRewards.push_back(storm::utility::zero<ValueType>());
+                }
+                if (!schedulerChoices.empty()) {
+                    subSchedulerChoices.push_back(0);
+                }
+            }
+            subValues.push_back(computeRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>());
+            subValues.push_back(storm::utility::zero<ValueType>());
+
+            storm::models::sparse::StateLabeling subLabeling(numberOfSubStates);
+            subLabeling.addLabel("init");
+            uint64_t initialState = exploredMdp->getInitialStates().getNextSetIndex(0);
+            subLabeling.addLabelToState("init", affectedStates.get(initialState) ? toSubStateMap[initialState] : subTargetState);
+            storm::storage::BitVector subTargetStates = exploredMdp->getStates("target") % affectedStates;
+            subTargetStates.resize(numberOfSubStates, false);
+            subTargetStates.set(subTargetState, true);
+            subLabeling.addLabel("target", std::move(subTargetStates));
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> subRewardModels;
+            if (computeRewards) {
+                subRewardModels.emplace("default", storm::models::sparse::StandardRewardModel<ValueType>(boost::optional<std::vector<ValueType>>(), std::move(subActionRewards)));
+            }
+            storm::storage::sparse::ModelComponents<ValueType> subModelComponents(builder.build(), std::move(subLabeling), std::move(subRewardModels));
+            auto subMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(subModelComponents));
+
+            auto property = createStandardProperty(dir, computeRewards);
+            auto task = createStandardCheckTask(property, subValues, subSchedulerChoices);
+            std::unique_ptr<storm::modelchecker::CheckResult> res(storm::api::verifyWithSparseEngine<ValueType>(subMdp, task));
+            if (!res) {
+                return false;
+            }
+
+            // Write the results back.
+            auto const &subResult = res->asExplicitQuantitativeCheckResult<ValueType>();
+            if (subResult.hasScheduler()) {
+                schedulerChoices.resize(exploredMdp->getNumberOfStates(), 0);
+            }
+            uint64_t subState = 0;
+            for (auto const &state : affectedStates) {
+                values[state] = subResult.getValueVector()[subState];
+                if (subResult.hasScheduler()) {
+                    schedulerChoices[state] = subResult.getScheduler().getChoice(subState).getDeterministicChoice();
+                }
+                ++subState;
+            }
+            hasCheckedValues = true;
+            return true;
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         bool BeliefMdpExplorer<PomdpType, BeliefValueType>::hasComputedValues() const {
             return status == Status::ModelChecked;
@@ -720,12 +914,25 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType>
         storm::modelchecker::CheckTask<storm::logic::Formula, typename BeliefMdpExplorer<PomdpType, BeliefValueType>::ValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property, std::vector<ValueType> const &valueHint,
+                                                                               std::vector<uint64_t> const &schedulerChoiceHint) {
             //Note: The property should not run out of scope after calling this because the task only stores the property by reference.
             // Therefore, this method needs the property by reference (and not const reference)
             auto task = storm::api::createTask<ValueType>(property, false);
             auto hint = storm::modelchecker::ExplicitModelCheckerHint<ValueType>();
-            hint.setResultHint(values);
+            hint.setResultHint(valueHint);
+            if (incrementalChecking) {
+                // The scheduler is used as a hint in the next check.
+                task.setProduceSchedulers();
+                if (!schedulerChoiceHint.empty()) {
+                    storm::storage::Scheduler<ValueType> schedulerHint(valueHint.size());
+                    for (uint64_t state = 0; state < valueHint.size(); ++state) {
+                        // States that were added since the last check choose their first action.
+                        schedulerHint.setChoice(state < schedulerChoiceHint.size() ? schedulerChoiceHint[state] : 0, state);
+                    }
+                    hint.setSchedulerHint(std::move(schedulerHint));
+                }
+            }
             auto hintPtr = std::make_shared<storm::modelchecker::ExplicitModelCheckerHint<ValueType>>(hint);
             task.setHint(hintPtr);
             return task;
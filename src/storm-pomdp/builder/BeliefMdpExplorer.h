@@ -38,7 +38,12 @@ namespace storm {
                 ModelChecked
             };
 
-            BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds);
+            /*!
+             * Creates an explorer.
+             * @param incrementalChecking If set, a restarted exploration is checked incrementally, i.e. only the states that can reach a state whose behavior
+             * differs from the previously checked MDP are checked again. The values and scheduler of the previous check are used as hints.
+             */
+            BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager, storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds, bool incrementalChecking = false);
 
             BeliefMdpExplorer(BeliefMdpExplorer &&other) = default;
 
@@ -58,6 +63,12 @@ namespace storm {
 
             BeliefId exploreNextState();
 
+            /*!
+             * Retrieves the beliefs of the (at most the given number of) states that are explored next, in the order
+             * in which they are explored.
+             */
+            std::vector<BeliefId> getBeliefIdsToExplore(uint64_t maxNumberOfBeliefs) const;
+
             void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
                                              ValueType const &bottomStateValue = storm::utility::zero<ValueType>());
 
@@ -173,7 +184,20 @@ namespace storm {
 
             std::shared_ptr<storm::logic::Formula const> createStandardProperty(storm::solver::OptimizationDirection const &dir, bool computeRewards);
 
-            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property);
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> createStandardCheckTask(std::shared_ptr<storm::logic::Formula const> &property, std::vector<ValueType> const &valueHint, std::vector<uint64_t> const &schedulerChoiceHint);
+
+            /*!
+             * Computes the states of the current exploration whose transitions, rewards or target flag differ from the previously explored MDP.
+             * States that did not exist in the previously explored MDP are considered as changed.
+             */
+            storm::storage::BitVector computeChangedMdpStates() const;
+
+            /*!
+             * Checks the sub-MDP induced by the given states of the explored MDP. Transitions to the remaining states are redirected to extra states
+             * according to the values of the remaining states.
+             * @return false if this is not possible, e.g., because one of the remaining states has an infinite value.
+             */
+            bool computeValuesOfAffectedMdpStates(storm::solver::OptimizationDirection const &dir, storm::storage::BitVector const &affectedStates);
 
             MdpStateType getCurrentMdpState() const;
 
@@ -218,6 +242,12 @@ namespace storm {
             std::vector<ValueType> lowerValueBounds;
             std::vector<ValueType> upperValueBounds;
             std::vector<ValueType> values; // Contains an estimate during building and the actual result after a check has performed
+            
+            // Information for the incremental checking
+            bool incrementalChecking;
+            bool hasCheckedValues; // True if the values of the old MDP states are the result of a check
+            boost::optional<storm::storage::BitVector> changedMdpStates;
+            std::vector<uint64_t> schedulerChoices; // The (local) choices of the scheduler obtained in the most recent check
             boost::optional<storm::storage::BitVector> optimalChoices;
             boost::optional<storm::storage::BitVector> optimalChoicesReachableMdpStates;
             
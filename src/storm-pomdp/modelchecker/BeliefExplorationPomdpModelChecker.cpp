@@ -217,7 +217,7 @@ namespace storm {
                     if (rewardModelName) {
                         manager->setRewardModel(rewardModelName);
                     }
-                    auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds);
+                    auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds, options.incrementalChecking);
                     HeuristicParameters heuristicParameters;
                     heuristicParameters.gapThreshold = options.gapThresholdInit;
                     heuristicParameters.observationThreshold = options.obsThresholdInit; // Actually not relevant without refinement
@@ -242,7 +242,7 @@ namespace storm {
                     if (rewardModelName) {
                         manager->setRewardModel(rewardModelName);
                     }
-                    auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds);
+                    auto approx = std::make_shared<ExplorerType>(manager, pomdpValueBounds, options.incrementalChecking);
                     HeuristicParameters heuristicParameters;
                     heuristicParameters.gapThreshold = options.gapThresholdInit;
                     heuristicParameters.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
@@ -285,7 +285,7 @@ namespace storm {
                     if (rewardModelName) {
                         overApproxBeliefManager->setRewardModel(rewardModelName);
                     }
-                    overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, pomdpValueBounds);
+                    overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, pomdpValueBounds, options.incrementalChecking);
                     overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
                     overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
                     overApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit == 0 ? std::numeric_limits<uint64_t>::max() : options.sizeThresholdInit;
@@ -309,7 +309,7 @@ namespace storm {
                     if (rewardModelName) {
                         underApproxBeliefManager->setRewardModel(rewardModelName);
                     }
-                    underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, pomdpValueBounds);
+                    underApproximation = std::make_shared<ExplorerType>(underApproxBeliefManager, pomdpValueBounds, options.incrementalChecking);
                     underApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
                     underApproxHeuristicPar.optimalChoiceValueEpsilon = options.optimalChoiceValueThresholdInit;
                     underApproxHeuristicPar.sizeThreshold = options.sizeThresholdInit;
@@ -565,6 +565,9 @@ namespace storm {
                         STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because the exploration time limit is exceeded.");
                         fixPoint = false;
                     }
+                    if (options.parallelExpansionBatchSize > 0) {
+                        prefetchSuccessors(targetObservations, *overApproximation, *beliefManager, observationResolutionVector);
+                    }
 
                     uint64_t currId = overApproximation->exploreNextState();
                     bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
@@ -727,6 +730,8 @@ namespace storm {
                     return false;
                 }
                 
+                // The resolutions might change before the next exploration.
+                beliefManager->clearPrefetchedSuccessors();
                 overApproximation->finishExploration();
                 statistics.overApproximationBuildTime.stop();
                 
@@ -741,6 +746,22 @@ namespace storm {
                 return fixPoint;
             }
 
+            template<typename PomdpModelType, typename BeliefValueType>
+            void BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::prefetchSuccessors(std::set<uint32_t> const &targetObservations, ExplorerType const& explorer, BeliefManagerType& beliefManager, boost::optional<std::vector<BeliefValueType>> const& observationResolutionVector) {
+                // Only compute a new batch if the next belief is expanded but not prefetched.
+                auto nextBeliefIds = explorer.getBeliefIdsToExplore(1);
+                if (nextBeliefIds.empty() || beliefManager.hasPrefetchedSuccessors(nextBeliefIds.front()) || targetObservations.count(beliefManager.getBeliefObservation(nextBeliefIds.front())) != 0) {
+                    return;
+                }
+                std::vector<typename BeliefManagerType::BeliefId> beliefIds;
+                for (auto const& beliefId : explorer.getBeliefIdsToExplore(options.parallelExpansionBatchSize)) {
+                    if (targetObservations.count(beliefManager.getBeliefObservation(beliefId)) == 0) {
+                        beliefIds.push_back(beliefId);
+                    }
+                }
+                beliefManager.prefetchSuccessors(beliefIds, observationResolutionVector);
+            }
+
             template<typename PomdpModelType, typename BeliefValueType>
             bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType>::buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation) {
                 statistics.underApproximationBuildTime.start();
@@ -771,6 +792,9 @@ namespace storm {
                         STORM_LOG_INFO("Exploration time limit exceeded.");
                         timeLimitExceeded = true;
                     }
+                    if (options.parallelExpansionBatchSize > 0 && !timeLimitExceeded) {
+                        prefetchSuccessors(targetObservations, *underApproximation, *beliefManager);
+                    }
                     uint64_t currId = underApproximation->exploreNextState();
                     
                     uint32_t currObservation = beliefManager->getBeliefObservation(currId);
@@ -846,6 +870,7 @@ namespace storm {
                     return false;
                 }
                 
+                beliefManager->clearPrefetchedSuccessors();
                 underApproximation->finishExploration();
                 statistics.underApproximationBuildTime.stop();
 
@@ -92,6 +92,12 @@ namespace storm {
                  */
                 bool buildUnderApproximation(std::set<uint32_t> const &targetObservations, bool min, bool computeRewards, bool refine, HeuristicParameters const& heuristicParameters, std::shared_ptr<BeliefManagerType>& beliefManager, std::shared_ptr<ExplorerType>& underApproximation);
 
+                /**
+                 * Computes the successors of the next beliefs of the exploration in parallel (unless the successors of the next belief are already available).
+                 * Beliefs with a target observation are skipped as they are not expanded.
+                 */
+                void prefetchSuccessors(std::set<uint32_t> const &targetObservations, ExplorerType const& explorer, BeliefManagerType& beliefManager, boost::optional<std::vector<BeliefValueType>> const& observationResolutionVector = boost::none);
+
                 BeliefValueType rateObservation(typename ExplorerType::SuccessorObservationInformation const& info, BeliefValueType const& observationResolution, BeliefValueType const& maxResolution);
                 
                 std::vector<BeliefValueType> getObservationRatings(std::shared_ptr<ExplorerType> const& overApproximation, std::vector<BeliefValueType> const& observationResolutionVector);
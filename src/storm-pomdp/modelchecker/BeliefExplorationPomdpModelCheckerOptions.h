@@ -39,6 +39,8 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                bool incrementalChecking = false; // If set, refined belief MDPs are only checked on the states that are affected by the refinement (using the previous results as hints)
+                uint64_t parallelExpansionBatchSize = 0; // If non-zero, the successors of this many beliefs are computed in parallel before they are explored
             };
         }
     }
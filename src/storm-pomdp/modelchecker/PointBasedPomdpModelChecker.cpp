@@ -0,0 +1,462 @@
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+
+#include "storm-pomdp/analysis/FormulaInformation.h"
+#include "storm-pomdp/transformer/MakeStateSetObservationClosed.h"
+#include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace pomdp {
+        namespace modelchecker {
+
+            namespace detail {
+                /*!
+                 * Computes the dot product of two dense vectors of the given size.
+                 * The sum is split into independent accumulators so that the compiler can vectorise the loop.
+                 */
+                template<typename ValueType>
+                ValueType denseDotProduct(ValueType const* lhs, ValueType const* rhs, uint64_t size) {
+                    ValueType sum0 = storm::utility::zero<ValueType>();
+                    ValueType sum1 = storm::utility::zero<ValueType>();
+                    ValueType sum2 = storm::utility::zero<ValueType>();
+                    ValueType sum3 = storm::utility::zero<ValueType>();
+                    uint64_t i = 0;
+                    for (; i + 4 <= size; i += 4) {
+                        sum0 += lhs[i] * rhs[i];
+                        sum1 += lhs[i + 1] * rhs[i + 1];
+                        sum2 += lhs[i + 2] * rhs[i + 2];
+                        sum3 += lhs[i + 3] * rhs[i + 3];
+                    }
+                    for (; i < size; ++i) {
+                        sum0 += lhs[i] * rhs[i];
+                    }
+                    return (sum0 + sum1) + (sum2 + sum3);
+                }
+            }
+
+            template<typename PomdpModelType>
+            PointBasedPomdpModelChecker<PomdpModelType>::Result::Result(ValueType const& bound, bool isLowerBound) : bound(bound), isLowerBound(isLowerBound), numberOfBeliefs(0), numberOfAlphaVectors(0), numberOfIterations(0) {
+                // Intentionally left empty
+            }
+
+            template<typename PomdpModelType>
+            PointBasedPomdpModelChecker<PomdpModelType>::AlphaVectorSet::AlphaVectorSet(uint64_t dimension) : dimension(dimension) {
+                // Intentionally left empty
+            }
+
+            template<typename PomdpModelType>
+            uint64_t PointBasedPomdpModelChecker<PomdpModelType>::AlphaVectorSet::size() const {
+                return dimension == 0 ? 0 : values.size() / dimension;
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::AlphaVectorSet::empty() const {
+                return values.empty();
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType const* PointBasedPomdpModelChecker<PomdpModelType>::AlphaVectorSet::get(uint64_t index) const {
+                STORM_LOG_ASSERT(index < size(), "Alpha vector index " << index << " is out of range.");
+                return values.data() + index * dimension;
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::AlphaVectorSet::add(ValueType const* alphaVector) {
+                values.insert(values.end(), alphaVector, alphaVector + dimension);
+            }
+
+            template<typename PomdpModelType>
+            PointBasedPomdpModelChecker<PomdpModelType>::PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options) : inputPomdp(pomdp), options(options), minimize(false) {
+                STORM_LOG_ASSERT(inputPomdp, "The given POMDP is not initialized.");
+                STORM_LOG_ERROR_COND(inputPomdp->isCanonic(), "Input Pomdp is not known to be canonic. This might lead to unexpected verification results.");
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::Result PointBasedPomdpModelChecker<PomdpModelType>::check(storm::logic::Formula const& formula) {
+                // Potentially reset preprocessed model from previous call
+                preprocessedPomdp.reset();
+
+                auto formulaInfo = storm::pomdp::analysis::getFormulaInformation(pomdp(), formula);
+                STORM_LOG_THROW(formulaInfo.isNonNestedReachabilityProbability() || formulaInfo.isNonNestedExpectedRewardFormula(), storm::exceptions::NotSupportedException, "Unsupported formula '" << formula << "'.");
+                minimize = formulaInfo.minimize();
+
+                std::set<uint32_t> targetObservations;
+                if (formulaInfo.getTargetStates().observationClosed) {
+                    targetObservations = formulaInfo.getTargetStates().observations;
+                } else {
+                    storm::transformer::MakeStateSetObservationClosed<ValueType> obsCloser(inputPomdp);
+                    std::tie(preprocessedPomdp, targetObservations) = obsCloser.transform(formulaInfo.getTargetStates().states);
+                }
+                boost::optional<std::string> rewardModelName;
+                storm::storage::BitVector sinkStates(pomdp().getNumberOfStates(), false);
+                if (formulaInfo.isNonNestedExpectedRewardFormula()) {
+                    rewardModelName = formulaInfo.getRewardModelName();
+                } else {
+                    sinkStates = formulaInfo.getSinkStates().states;
+                }
+
+                // The values of memoryless schedulers serve as initial alpha vectors
+                auto pomdpValueBounds = TrivialPomdpValueBoundsModelChecker<storm::models::sparse::Pomdp<ValueType>>(pomdp()).getValueBounds(formula, formulaInfo);
+                initializeStateInformation(formulaInfo.getTargetStates().states, sinkStates, rewardModelName);
+                initializeAlphaVectors(pomdpValueBounds);
+
+                BeliefManagerType beliefManager(pomdp(), options.numericPrecision, BeliefManagerType::TriangulationMode::Static);
+                storm::utility::RandomProbabilityGenerator<double> generator(options.seed);
+                auto sampledBeliefIds = sampleBeliefs(beliefManager, targetObservations, generator);
+                std::vector<DenseBelief> beliefs;
+                beliefs.reserve(sampledBeliefIds.size());
+                for (auto const& beliefId : sampledBeliefIds) {
+                    beliefs.push_back(toDenseBelief(beliefManager, beliefId));
+                }
+                DenseBelief initialBelief = toDenseBelief(beliefManager, beliefManager.getInitialBelief());
+                if (alphaVectors[initialBelief.observation].empty()) {
+                    // This can only happen for expected rewards where all guessed schedulers yield infinite values.
+                    STORM_LOG_WARN("No finite initial alpha vectors are known for the initial belief.");
+                    return Result(minimize ? storm::utility::infinity<ValueType>() : storm::utility::zero<ValueType>(), !minimize);
+                }
+
+                Result result(findBestAlphaVector(alphaVectors[initialBelief.observation], initialBelief.values.data()).second, !minimize);
+                result.numberOfBeliefs = beliefs.size();
+                STORM_LOG_INFO("Initial " << (result.isLowerBound ? "lower" : "upper") << " bound is " << result.bound << ". Running point-based value iteration on " << beliefs.size() << " beliefs.");
+
+                std::vector<ValueType> currentValues(beliefs.size());
+                std::vector<ValueType> newAlphaVector;
+                std::vector<uint64_t> unimprovedBeliefs;
+                storm::storage::BitVector sampledObservations(pomdp().getNrObservations(), false);
+                for (auto const& belief : beliefs) {
+                    sampledObservations.set(belief.observation, true);
+                }
+                while (result.numberOfIterations < options.maxIterations && !beliefs.empty()) {
+                    if (storm::utility::resources::isTerminate()) {
+                        STORM_LOG_INFO("Point-based value iteration aborted after " << result.numberOfIterations << " iterations.");
+                        break;
+                    }
+                    for (uint64_t beliefIndex = 0; beliefIndex < beliefs.size(); ++beliefIndex) {
+                        currentValues[beliefIndex] = findBestAlphaVector(alphaVectors[beliefs[beliefIndex].observation], beliefs[beliefIndex].values.data()).second;
+                    }
+                    // Only observations that occur in a sampled belief get new alpha vectors. The remaining ones are kept.
+                    std::vector<AlphaVectorSet> newAlphaVectors;
+                    newAlphaVectors.reserve(alphaVectors.size());
+                    for (uint64_t observation = 0; observation < alphaVectors.size(); ++observation) {
+                        if (sampledObservations.get(observation)) {
+                            newAlphaVectors.emplace_back(alphaVectors[observation].dimension);
+                        } else {
+                            newAlphaVectors.push_back(alphaVectors[observation]);
+                        }
+                    }
+
+                    // Perseus: Back up randomly chosen beliefs until the value of every sampled belief did not get worse
+                    unimprovedBeliefs.resize(beliefs.size());
+                    std::iota(unimprovedBeliefs.begin(), unimprovedBeliefs.end(), 0);
+                    ValueType maxImprovement = storm::utility::zero<ValueType>();
+                    while (!unimprovedBeliefs.empty()) {
+                        uint64_t beliefIndex = unimprovedBeliefs[generator.random_uint(0, unimprovedBeliefs.size() - 1)];
+                        DenseBelief const& belief = beliefs[beliefIndex];
+                        ValueType newValue;
+                        if (backup(belief, newAlphaVector, newValue) && !isBetter(currentValues[beliefIndex], newValue)) {
+                            newAlphaVectors[belief.observation].add(newAlphaVector.data());
+                        } else {
+                            auto const& oldAlphaVectors = alphaVectors[belief.observation];
+                            newAlphaVectors[belief.observation].add(oldAlphaVectors.get(findBestAlphaVector(oldAlphaVectors, belief.values.data()).first));
+                        }
+                        // Remove all beliefs whose value did not get worse. Only beliefs with the same observation are affected.
+                        auto const& updatedAlphaVectors = newAlphaVectors[belief.observation];
+                        for (uint64_t i = 0; i < unimprovedBeliefs.size();) {
+                            uint64_t const& otherIndex = unimprovedBeliefs[i];
+                            if (beliefs[otherIndex].observation == belief.observation) {
+                                ValueType otherValue = detail::denseDotProduct(updatedAlphaVectors.get(updatedAlphaVectors.size() - 1), beliefs[otherIndex].values.data(), updatedAlphaVectors.dimension);
+                                if (!isBetter(currentValues[otherIndex], otherValue)) {
+                                    maxImprovement = std::max<ValueType>(maxImprovement, storm::utility::abs<ValueType>(otherValue - currentValues[otherIndex]));
+                                    unimprovedBeliefs[i] = unimprovedBeliefs.back();
+                                    unimprovedBeliefs.pop_back();
+                                    continue;
+                                }
+                            }
+                            ++i;
+                        }
+                    }
+                    alphaVectors = std::move(newAlphaVectors);
+                    ++result.numberOfIterations;
+
+                    ValueType newBound = findBestAlphaVector(alphaVectors[initialBelief.observation], initialBelief.values.data()).second;
+                    if (isBetter(newBound, result.bound)) {
+                        result.bound = newBound;
+                    }
+                    STORM_LOG_INFO("Point-based value iteration " << result.numberOfIterations << ": " << (result.isLowerBound ? "lower" : "upper") << " bound is " << result.bound << " (maximal improvement " << maxImprovement << ").");
+                    if (maxImprovement <= options.precision) {
+                        break;
+                    }
+                }
+                result.numberOfAlphaVectors = 0;
+                for (auto const& alphaVectorSet : alphaVectors) {
+                    result.numberOfAlphaVectors += alphaVectorSet.size();
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            PomdpModelType const& PointBasedPomdpModelChecker<PomdpModelType>::pomdp() const {
+                if (preprocessedPomdp) {
+                    return *preprocessedPomdp;
+                } else {
+                    return *inputPomdp;
+                }
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::isBetter(ValueType const& lhs, ValueType const& rhs) const {
+                return minimize ? lhs < rhs : lhs > rhs;
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::initializeStateInformation(storm::storage::BitVector const& targetStates, storm::storage::BitVector const& sinkStates, boost::optional<std::string> const& rewardModelName) {
+                uint64_t numberOfStates = pomdp().getNumberOfStates();
+                observationStates.assign(pomdp().getNrObservations(), std::vector<uint64_t>());
+                localStateIndices.resize(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    auto& states = observationStates[pomdp().getObservation(state)];
+                    localStateIndices[state] = states.size();
+                    states.push_back(state);
+                }
+
+                // Target and sink states have a fixed value
+                fixedStates = targetStates | sinkStates;
+                fixedStateValues.assign(numberOfStates, storm::utility::zero<ValueType>());
+                if (!rewardModelName) {
+                    for (auto const& state : targetStates) {
+                        fixedStateValues[state] = storm::utility::one<ValueType>();
+                    }
+                    choiceRewards.clear();
+                } else {
+                    choiceRewards = pomdp().getRewardModel(rewardModelName.get()).getTotalRewardVector(pomdp().getTransitionMatrix());
+                }
+
+                successorBeliefs.clear();
+                for (auto const& states : observationStates) {
+                    successorBeliefs.emplace_back(states.size(), storm::utility::zero<ValueType>());
+                }
+                touchedObservations.clear();
+                selectedAlphaVectors.assign(observationStates.size(), std::numeric_limits<uint64_t>::max());
+            }
+
+            template<typename PomdpModelType>
+            void PointBasedPomdpModelChecker<PomdpModelType>::initializeAlphaVectors(storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds) {
+                // Only the values of the guessed schedulers are achievable. The remaining bounds stem from the fully observable MDP.
+                auto const& schedulerValues = minimize ? pomdpValueBounds.upper : pomdpValueBounds.lower;
+                alphaVectors.clear();
+                std::vector<ValueType> alphaVector;
+                for (auto const& states : observationStates) {
+                    alphaVectors.emplace_back(states.size());
+                    for (auto const& values : schedulerValues) {
+                        alphaVector.clear();
+                        for (auto const& state : states) {
+                            if (storm::utility::isInfinity(values[state])) {
+                                break;
+                            }
+                            alphaVector.push_back(fixedStates.get(state) ? fixedStateValues[state] : values[state]);
+                        }
+                        if (alphaVector.size() == states.size()) {
+                            alphaVectors.back().add(alphaVector.data());
+                        }
+                    }
+                }
+            }
+
+            template<typename PomdpModelType>
+            std::vector<typename PointBasedPomdpModelChecker<PomdpModelType>::BeliefManagerType::BeliefId> PointBasedPomdpModelChecker<PomdpModelType>::sampleBeliefs(BeliefManagerType& beliefManager, std::set<uint32_t> const& targetObservations, storm::utility::RandomProbabilityGenerator<double>& generator) const {
+                typedef typename BeliefManagerType::BeliefId BeliefId;
+                std::vector<BeliefId> result;
+                std::unordered_set<BeliefId> foundBeliefs;
+                auto isTargetBelief = [&beliefManager, &targetObservations](BeliefId const& beliefId) {
+                    return targetObservations.count(beliefManager.getBeliefObservation(beliefId)) > 0;
+                };
+                BeliefId initialBelief = beliefManager.getInitialBelief();
+                if (isTargetBelief(initialBelief) || options.numberOfBeliefs == 0) {
+                    return result;
+                }
+                foundBeliefs.insert(initialBelief);
+                result.push_back(initialBelief);
+
+                // Sample beliefs using random walks that start at the initial belief.
+                // The number of walks is bounded since the reachable belief space might be smaller than the requested number of beliefs.
+                uint64_t const maxNumberOfWalks = 10 * options.numberOfBeliefs;
+                for (uint64_t walk = 0; walk < maxNumberOfWalks && result.size() < options.numberOfBeliefs; ++walk) {
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                    BeliefId currentBelief = initialBelief;
+                    for (uint64_t depth = 0; depth < options.explorationDepth && result.size() < options.numberOfBeliefs; ++depth) {
+                        uint64_t action = generator.random_uint(0, beliefManager.getBeliefNumberOfChoices(currentBelief) - 1);
+                        auto successors = beliefManager.expand(currentBelief, action);
+                        STORM_LOG_ASSERT(!successors.empty(), "Belief has no successors.");
+                        double sample = generator.random();
+                        currentBelief = successors.back().first;
+                        for (auto const& successor : successors) {
+                            sample -= storm::utility::convertNumber<double>(successor.second);
+                            if (sample < 0.0) {
+                                currentBelief = successor.first;
+                                break;
+                            }
+                        }
+                        if (isTargetBelief(currentBelief)) {
+                            break;
+                        }
+                        if (foundBeliefs.insert(currentBelief).second) {
+                            result.push_back(currentBelief);
+                        }
+                    }
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            typename PointBasedPomdpModelChecker<PomdpModelType>::DenseBelief PointBasedPomdpModelChecker<PomdpModelType>::toDenseBelief(BeliefManagerType const& beliefManager, typename BeliefManagerType::BeliefId const& beliefId) const {
+                DenseBelief result;
+                auto belief = beliefManager.getBeliefCopy(beliefId);
+                STORM_LOG_ASSERT(!belief.empty(), "Empty belief.");
+                result.observation = pomdp().getObservation(belief.begin()->first);
+                result.values.assign(observationStates[result.observation].size(), storm::utility::zero<ValueType>());
+                for (auto const& entry : belief) {
+                    result.values[localStateIndices[entry.first]] = entry.second;
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            std::pair<uint64_t, typename PointBasedPomdpModelChecker<PomdpModelType>::ValueType> PointBasedPomdpModelChecker<PomdpModelType>::findBestAlphaVector(AlphaVectorSet const& alphaVectorSet, ValueType const* belief) const {
+                STORM_LOG_ASSERT(!alphaVectorSet.empty(), "Expected a non-empty set of alpha vectors.");
+                std::pair<uint64_t, ValueType> result(0, detail::denseDotProduct(alphaVectorSet.get(0), belief, alphaVectorSet.dimension));
+                for (uint64_t index = 1; index < alphaVectorSet.size(); ++index) {
+                    ValueType value = detail::denseDotProduct(alphaVectorSet.get(index), belief, alphaVectorSet.dimension);
+                    if (isBetter(value, result.second)) {
+                        result.first = index;
+                        result.second = std::move(value);
+                    }
+                }
+                return result;
+            }
+
+            template<typename PomdpModelType>
+            bool PointBasedPomdpModelChecker<PomdpModelType>::backup(DenseBelief const& belief, std::vector<ValueType>& newAlphaVector, ValueType& value) {
+                auto const& states = observationStates[belief.observation];
+                auto const& transitionMatrix = pomdp().getTransitionMatrix();
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                uint64_t const noAlphaVector = std::numeric_limits<uint64_t>::max();
+                uint64_t const numberOfActions = transitionMatrix.getRowGroupSize(states.front());
+
+                bool hasBestAction = false;
+                uint64_t bestAction = 0;
+                std::vector<std::pair<uint32_t, uint64_t>> bestSelection, currentSelection;
+                for (uint64_t action = 0; action < numberOfActions; ++action) {
+                    // Compute the (unnormalized) successor beliefs for each successor observation
+                    ValueType actionValue = storm::utility::zero<ValueType>();
+                    for (uint64_t localState = 0; localState < states.size(); ++localState) {
+                        ValueType const& beliefValue = belief.values[localState];
+                        if (storm::utility::isZero(beliefValue)) {
+                            continue;
+                        }
+                        uint64_t const& state = states[localState];
+                        if (fixedStates.get(state)) {
+                            actionValue += beliefValue * fixedStateValues[state];
+                            continue;
+                        }
+                        uint64_t row = rowGroupIndices[state] + action;
+                        if (!choiceRewards.empty()) {
+                            actionValue += beliefValue * choiceRewards[row];
+                        }
+                        for (auto const& entry : transitionMatrix.getRow(row)) {
+                            uint32_t successorObservation = pomdp().getObservation(entry.getColumn());
+                            auto& successorBelief = successorBeliefs[successorObservation];
+                            if (std::find(touchedObservations.begin(), touchedObservations.end(), successorObservation) == touchedObservations.end()) {
+                                touchedObservations.push_back(successorObservation);
+                            }
+                            successorBelief[localStateIndices[entry.getColumn()]] += beliefValue * entry.getValue();
+                        }
+                    }
+
+                    // Pick the best alpha vector for each successor belief
+                    bool actionIsValid = true;
+                    currentSelection.clear();
+                    for (auto const& successorObservation : touchedObservations) {
+                        auto& successorBelief = successorBeliefs[successorObservation];
+                        if (actionIsValid) {
+                            if (alphaVectors[successorObservation].empty()) {
+                                actionIsValid = false;
+                            } else {
+                                auto bestAlphaVector = findBestAlphaVector(alphaVectors[successorObservation], successorBelief.data());
+                                actionValue += bestAlphaVector.second;
+                                currentSelection.emplace_back(successorObservation, bestAlphaVector.first);
+                            }
+                        }
+                        std::fill(successorBelief.begin(), successorBelief.end(), storm::utility::zero<ValueType>());
+                    }
+                    touchedObservations.clear();
+                    if (actionIsValid && (!hasBestAction || isBetter(actionValue, value))) {
+                        hasBestAction = true;
+                        bestAction = action;
+                        value = std::move(actionValue);
+                        std::swap(bestSelection, currentSelection);
+                    }
+                }
+                if (!hasBestAction) {
+                    return false;
+                }
+
+                // Build the alpha vector of the policy tree that plays the best action and then continues according to the selected alpha vectors.
+                // Successor observations that are not reached from the belief itself get the alpha vector with the best total sum.
+                for (auto const& selection : bestSelection) {
+                    selectedAlphaVectors[selection.first] = selection.second;
+                    touchedObservations.push_back(selection.first);
+                }
+                bool success = true;
+                newAlphaVector.assign(states.size(), storm::utility::zero<ValueType>());
+                for (uint64_t localState = 0; localState < states.size() && success; ++localState) {
+                    uint64_t const& state = states[localState];
+                    if (fixedStates.get(state)) {
+                        newAlphaVector[localState] = fixedStateValues[state];
+                        continue;
+                    }
+                    uint64_t row = rowGroupIndices[state] + bestAction;
+                    ValueType& stateValue = newAlphaVector[localState];
+                    if (!choiceRewards.empty()) {
+                        stateValue = choiceRewards[row];
+                    }
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        uint32_t successorObservation = pomdp().getObservation(entry.getColumn());
+                        auto const& successorAlphaVectors = alphaVectors[successorObservation];
+                        if (selectedAlphaVectors[successorObservation] == noAlphaVector) {
+                            if (successorAlphaVectors.empty()) {
+                                success = false;
+                                break;
+                            }
+                            std::vector<ValueType> const uniformWeights(successorAlphaVectors.dimension, storm::utility::one<ValueType>());
+                            selectedAlphaVectors[successorObservation] = findBestAlphaVector(successorAlphaVectors, uniformWeights.data()).first;
+                            touchedObservations.push_back(successorObservation);
+                        }
+                        stateValue += entry.getValue() * successorAlphaVectors.get(selectedAlphaVectors[successorObservation])[localStateIndices[entry.getColumn()]];
+                    }
+                }
+                for (auto const& observation : touchedObservations) {
+                    selectedAlphaVectors[observation] = noAlphaVector;
+                }
+                touchedObservations.clear();
+                return success;
+            }
+
+            template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<double>>;
+            template class PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<storm::RationalNumber>>;
+
+        }
+    }
+}
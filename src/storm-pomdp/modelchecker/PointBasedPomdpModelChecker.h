@@ -0,0 +1,134 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+#include <memory>
+#include <boost/optional.hpp>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/random.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm-pomdp/storage/BeliefManager.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace pomdp {
+        namespace modelchecker {
+
+            template<typename ValueType>
+            struct TrivialPomdpValueBounds;
+
+            template<typename ValueType>
+            struct PointBasedPomdpModelCheckerOptions {
+                uint64_t numberOfBeliefs = 1000; /// The number of beliefs that are sampled (including the initial belief)
+                uint64_t explorationDepth = 100; /// The maximal length of a single random walk through the belief space
+                uint64_t maxIterations = 1000; /// The maximal number of (Perseus) iterations
+                ValueType precision = storm::utility::convertNumber<ValueType>(1e-6); /// Stop if no sampled belief improves by more than this value
+                ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
+                uint64_t seed = 0; /// Seed for sampling the beliefs
+            };
+
+            /*!
+             * Computes a bound on the optimal reachability probability (or expected reward) of a POMDP using point-based value iteration
+             * over a set of sampled beliefs (Perseus-style). Values are represented by alpha vectors, i.e., by the values of finite-horizon
+             * policy trees whose leaves are memoryless observation-based schedulers. The computed bound is therefore achievable,
+             * i.e., it is a lower bound when maximizing and an upper bound when minimizing. It is improved in every iteration and a
+             * valid bound is also available if the computation is aborted.
+             */
+            template<typename PomdpModelType>
+            class PointBasedPomdpModelChecker {
+            public:
+                typedef typename PomdpModelType::ValueType ValueType;
+                typedef storm::storage::BeliefManager<PomdpModelType> BeliefManagerType;
+                typedef PointBasedPomdpModelCheckerOptions<ValueType> Options;
+
+                struct Result {
+                    Result(ValueType const& bound, bool isLowerBound);
+                    ValueType bound;
+                    bool isLowerBound;
+                    uint64_t numberOfBeliefs;
+                    uint64_t numberOfAlphaVectors;
+                    uint64_t numberOfIterations;
+                };
+
+                PointBasedPomdpModelChecker(std::shared_ptr<PomdpModelType> pomdp, Options options = Options());
+
+                Result check(storm::logic::Formula const& formula);
+
+            private:
+
+                /*!
+                 * The alpha vectors of a single observation. Each vector only ranges over the states with that observation (in ascending order)
+                 * and all vectors are stored consecutively so that evaluating a belief amounts to dense dot products.
+                 */
+                struct AlphaVectorSet {
+                    AlphaVectorSet(uint64_t dimension = 0);
+                    uint64_t size() const;
+                    bool empty() const;
+                    ValueType const* get(uint64_t index) const;
+                    void add(ValueType const* alphaVector);
+
+                    uint64_t dimension;
+                    std::vector<ValueType> values;
+                };
+
+                /*!
+                 * A sampled belief, stored densely over the states of its observation.
+                 */
+                struct DenseBelief {
+                    uint32_t observation;
+                    std::vector<ValueType> values;
+                };
+
+                PomdpModelType const& pomdp() const;
+
+                bool isBetter(ValueType const& lhs, ValueType const& rhs) const;
+
+                void initializeStateInformation(storm::storage::BitVector const& targetStates, storm::storage::BitVector const& sinkStates, boost::optional<std::string> const& rewardModelName);
+
+                void initializeAlphaVectors(storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const& pomdpValueBounds);
+
+                std::vector<typename BeliefManagerType::BeliefId> sampleBeliefs(BeliefManagerType& beliefManager, std::set<uint32_t> const& targetObservations, storm::utility::RandomProbabilityGenerator<double>& generator) const;
+
+                DenseBelief toDenseBelief(BeliefManagerType const& beliefManager, typename BeliefManagerType::BeliefId const& beliefId) const;
+
+                /*!
+                 * Finds the alpha vector of the given set that is best for the given (possibly unnormalized) dense belief.
+                 * @return the index of the alpha vector and its value at the belief
+                 */
+                std::pair<uint64_t, ValueType> findBestAlphaVector(AlphaVectorSet const& alphaVectorSet, ValueType const* belief) const;
+
+                /*!
+                 * Performs a point-based backup of the current alpha vectors at the given belief.
+                 * @param newAlphaVector is set to the resulting alpha vector
+                 * @param value is set to the value of the resulting alpha vector at the belief
+                 * @return false if no backup was possible, e.g., because no alpha vectors are known for a successor observation
+                 */
+                bool backup(DenseBelief const& belief, std::vector<ValueType>& newAlphaVector, ValueType& value);
+
+                std::shared_ptr<PomdpModelType> inputPomdp;
+                std::shared_ptr<PomdpModelType> preprocessedPomdp;
+                Options options;
+
+                bool minimize;
+                std::vector<std::vector<uint64_t>> observationStates;
+                std::vector<uint64_t> localStateIndices;
+                storm::storage::BitVector fixedStates;
+                std::vector<ValueType> fixedStateValues;
+                std::vector<ValueType> choiceRewards;
+                std::vector<AlphaVectorSet> alphaVectors;
+
+                // Scratch memory for backups
+                std::vector<std::vector<ValueType>> successorBeliefs;
+                std::vector<uint32_t> touchedObservations;
+                std::vector<uint64_t> selectedAlphaVectors;
+            };
+        }
+    }
+}
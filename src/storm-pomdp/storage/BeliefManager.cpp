@@ -1,6 +1,9 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <type_traits>
+
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
@@ -8,6 +11,11 @@
 namespace storm {
     namespace storage {
 
+        namespace {
+            // The initial number of slots of the lookup table (has to be a power of two).
+            uint64_t const initialLookupTableSize = 1024;
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation::size() const {
             return weights.size();
@@ -28,6 +36,58 @@ namespace storm {
             }
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator::const_iterator(BeliefManager const &manager, uint64_t position) : manager(&manager), position(position) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::pair<StateType, BeliefValueType const &> BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator::operator*() const {
+            return std::pair<StateType, BeliefValueType const &>(manager->beliefStates[position], manager->beliefValues[position]);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator &BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator::operator++() {
+            ++position;
+            return *this;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator::operator==(const_iterator const &other) const {
+            return position == other.position;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator::operator!=(const_iterator const &other) const {
+            return position != other.position;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::BeliefView(BeliefManager const &manager, BeliefId const &id) : manager(manager), id(id) {
+            // Intentionally left empty
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::begin() const {
+            return const_iterator(manager, manager.beliefOffsets[id]);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::const_iterator BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::end() const {
+            return const_iterator(manager, manager.beliefOffsets[id + 1]);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::size() const {
+            return manager.beliefOffsets[id + 1] - manager.beliefOffsets[id];
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        StateType const &BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::getFirstState() const {
+            STORM_LOG_ASSERT(size() > 0, "Empty belief.");
+            return manager.beliefStates[manager.beliefOffsets[id]];
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
             std::size_t seed = 0;
@@ -41,9 +101,10 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
-                : pomdp(pomdp), triangulationMode(triangulationMode) {
+                : pomdp(pomdp), triangulationMode(triangulationMode), prefetchedSuccessorsAreTriangulated(false) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
+            beliefOffsets.push_back(0);
+            beliefIdTable.assign(initialLookupTableSize, noId());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -121,24 +182,30 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-            return getBeliefObservation(getBelief(beliefId));
+            return pomdp.getObservation(getBelief(beliefId).getFirstState());
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-            auto const &belief = getBelief(beliefId);
-            return pomdp.getNumberOfChoices(belief.begin()->first);
+            return pomdp.getNumberOfChoices(getBelief(beliefId).getFirstState());
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            GridTriangulation gridTriangulation = triangulateBelief(getBeliefCopy(beliefId), resolution);
+            Triangulation result;
+            result.weights = std::move(gridTriangulation.weights);
+            result.gridPoints.reserve(gridTriangulation.gridPoints.size());
+            for (auto const &gridPoint : gridTriangulation.gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
+            return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -147,15 +214,14 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId const &beliefId, BeliefSupportType &support) {
-            auto const &belief = getBelief(beliefId);
-            for (auto const &entry : belief) {
+            for (auto const &entry : getBelief(beliefId)) {
                 support.insert(entry.first);
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-            return beliefs.size();
+            return beliefOffsets.size() - 1;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -172,23 +238,80 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::prefetchSuccessors(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions) {
+            // The successors are computed concurrently. No beliefs are added in the meantime, so the arena is only read.
+            std::vector<std::vector<SuccessorBeliefs>> successors(beliefIds.size());
+            auto computeSuccessors = [&] (uint64_t index) {
+                uint64_t numberOfChoices = pomdp.getNumberOfChoices(getBelief(beliefIds[index]).getFirstState());
+                successors[index].reserve(numberOfChoices);
+                for (uint64_t action = 0; action < numberOfChoices; ++action) {
+                    successors[index].push_back(computeSuccessorBeliefs(beliefIds[index], action, observationResolutions));
+                }
+            };
+#ifdef STORM_HAVE_INTELTBB
+            // Exact arithmetic on rational numbers is not thread-safe, so only beliefs over doubles are handled in parallel.
+            if (std::is_same<BeliefValueType, double>::value) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, beliefIds.size()), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        computeSuccessors(index);
+                    }
+                });
+            } else {
+#endif
+                for (uint64_t index = 0; index < beliefIds.size(); ++index) {
+                    computeSuccessors(index);
+                }
+#ifdef STORM_HAVE_INTELTBB
+            }
+#endif
+            prefetchedSuccessors.clear();
+            for (uint64_t index = 0; index < beliefIds.size(); ++index) {
+                prefetchedSuccessors.emplace(beliefIds[index], std::move(successors[index]));
+            }
+            prefetchedSuccessorsAreTriangulated = observationResolutions.is_initialized();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPrefetchedSuccessors(BeliefId const &beliefId) const {
+            return prefetchedSuccessors.count(beliefId) != 0;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::clearPrefetchedSuccessors() {
+            prefetchedSuccessors.clear();
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return BeliefView(*this, id);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefCopy(BeliefId const &id) const {
+            STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
+            STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
+            BeliefType belief;
+            belief.reserve(beliefOffsets[id + 1] - beliefOffsets[id]);
+            for (uint64_t position = beliefOffsets[id]; position < beliefOffsets[id + 1]; ++position) {
+                // The entries are stored in order, so we can insert at the end.
+                belief.emplace_hint(belief.end(), beliefStates[position], beliefValues[position]);
+            }
+            return belief;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            BeliefId id = beliefIdTable[findSlot(belief, BeliefHash()(belief))];
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+        template<typename BeliefRangeType>
+        std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefRangeType const &belief) const {
             std::stringstream str;
             str << "{ ";
             bool first = true;
@@ -205,16 +328,18 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+        template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const {
             if (first.size() != second.size()) {
                 return false;
             }
             auto secondIt = second.begin();
             for (auto const &firstEntry : first) {
-                if (firstEntry.first != secondIt->first) {
+                auto const &secondEntry = *secondIt;
+                if (firstEntry.first != secondEntry.first) {
                     return false;
                 }
-                if (!cc.isEqual(firstEntry.second, secondIt->second)) {
+                if (!cc.isEqual(firstEntry.second, secondEntry.second)) {
                     return false;
                 }
                 ++secondIt;
@@ -264,12 +389,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, GridTriangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (triangulation.weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
@@ -288,8 +413,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
-                for (auto const &pointEntry : gridPoint) {
+                for (auto const &pointEntry : triangulation.gridPoints[i]) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
                 }
@@ -309,14 +433,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -365,14 +489,14 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +533,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::GridTriangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            GridTriangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
                 result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.gridPoints.push_back(belief);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,7 +554,7 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation of belief " << toString(belief) << ".");
             return result;
         }
 
@@ -438,9 +562,22 @@ namespace storm {
         std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
         BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
                                                                              boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            auto prefetchedIt = prefetchedSuccessors.find(beliefId);
+            if (prefetchedIt != prefetchedSuccessors.end() && prefetchedSuccessorsAreTriangulated == observationTriangulationResolutions.is_initialized()) {
+                STORM_LOG_ASSERT(actionIndex < prefetchedIt->second.size(), "Action index " << actionIndex << " is out of range.");
+                return addSuccessorBeliefs(prefetchedIt->second[actionIndex]);
+            }
+            return addSuccessorBeliefs(computeSuccessorBeliefs(beliefId, actionIndex, observationTriangulationResolutions));
+        }
 
-            BeliefType belief = getBelief(beliefId);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::SuccessorBeliefs
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                                      boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            SuccessorBeliefs destinations;
+
+            // The computation is done on a copy of the belief, so the arena is only accessed once.
+            BeliefType belief = getBeliefCopy(beliefId);
 
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
@@ -470,13 +607,13 @@ namespace storm {
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    GridTriangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
+                    for (size_t j = 0; j < triangulation.weights.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        destinations.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
 
@@ -484,6 +621,17 @@ namespace storm {
 
         }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::addSuccessorBeliefs(SuccessorBeliefs const &successors) {
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(successors.size());
+            for (auto const &successor : successors) {
+                destinations.emplace_back(getOrAddBeliefId(successor.first), successor.second);
+            }
+            return destinations;
+        }
+
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::computeInitialBelief() {
             STORM_LOG_ASSERT(pomdp.getInitialStates().getNumberOfSetBits() < 2,
@@ -499,15 +647,68 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            std::size_t hash = BeliefHash()(belief);
+            uint64_t slot = findSlot(belief, hash);
+            if (beliefIdTable[slot] != noId()) {
+                return beliefIdTable[slot];
+            }
+
+            // The belief is new, so add it to the arena.
+            BeliefId id = getNumberOfBeliefIds();
+            for (auto const &entry : belief) {
+                beliefStates.push_back(entry.first);
+                beliefValues.push_back(entry.second);
+            }
+            beliefOffsets.push_back(beliefStates.size());
+            beliefHashes.push_back(hash);
+            beliefIdTable[slot] = id;
+
+            // Keep the load factor of the lookup table at most one half.
+            if (2 * getNumberOfBeliefIds() > beliefIdTable.size()) {
+                growLookupTable();
+            }
+            return id;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::findSlot(BeliefType const &belief, std::size_t const &hash) const {
+            uint64_t const mask = beliefIdTable.size() - 1;
+            for (uint64_t slot = hash & mask; ; slot = (slot + 1) & mask) {
+                BeliefId const &id = beliefIdTable[slot];
+                if (id == noId()) {
+                    return slot;
+                }
+                // Stored beliefs are compared exactly (not modulo the precision), as they are hashed exactly.
+                if (beliefHashes[id] == hash && beliefOffsets[id + 1] - beliefOffsets[id] == belief.size()) {
+                    uint64_t position = beliefOffsets[id];
+                    bool equal = true;
+                    for (auto const &entry : belief) {
+                        if (beliefStates[position] != entry.first || beliefValues[position] != entry.second) {
+                            equal = false;
+                            break;
+                        }
+                        ++position;
+                    }
+                    if (equal) {
+                        return slot;
+                    }
+                }
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::growLookupTable() {
+            std::vector<BeliefId> newTable(2 * beliefIdTable.size(), noId());
+            uint64_t const mask = newTable.size() - 1;
+            for (BeliefId id = 0; id < getNumberOfBeliefIds(); ++id) {
+                uint64_t slot = beliefHashes[id] & mask;
+                while (newTable[slot] != noId()) {
+                    slot = (slot + 1) & mask;
+                }
+                newTable[slot] = id;
+            }
+            beliefIdTable = std::move(newTable);
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
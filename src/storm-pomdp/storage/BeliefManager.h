@@ -53,12 +53,17 @@ namespace storm {
 
             uint32_t getBeliefObservation(BeliefId beliefId);
 
+            /*!
+             * Copies the belief with the given id out of the arena.
+             */
+            BeliefType getBeliefCopy(BeliefId const &id) const;
+
             uint64_t getBeliefNumberOfChoices(BeliefId beliefId);
 
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -69,7 +74,65 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Computes the successor beliefs of the given beliefs (for all their actions) in parallel and caches them,
+             * replacing previously prefetched successors. Subsequent calls to expand (if no resolutions are given) or
+             * expandAndTriangulate (if resolutions are given) for these beliefs then only assign the ids of the
+             * successors. As ids are still assigned in the order of these calls, the resulting ids are the same as
+             * without prefetching.
+             *
+             * @param beliefIds The beliefs that are expanded next.
+             * @param observationResolutions If given, the successors are triangulated with these resolutions. The
+             * resolutions must not change until the prefetched successors are cleared.
+             */
+            void prefetchSuccessors(std::vector<BeliefId> const &beliefIds, boost::optional<std::vector<BeliefValueType>> const &observationResolutions = boost::none);
+
+            /*!
+             * Retrieves whether the successors of the given belief have been prefetched.
+             */
+            bool hasPrefetchedSuccessors(BeliefId const &beliefId) const;
+
+            void clearPrefetchedSuccessors();
+
         private:
+            // The successor beliefs (with their probabilities) of a belief and an action whose ids are not yet assigned.
+            typedef std::vector<std::pair<BeliefType, ValueType>> SuccessorBeliefs;
+
+            // A triangulation whose grid points are not yet assigned ids.
+            struct GridTriangulation {
+                std::vector<BeliefType> gridPoints;
+                std::vector<BeliefValueType> weights;
+            };
+
+            /*!
+             * A read-only view on a belief that is stored in the arena of this manager. The view accesses the arena by
+             * index and therefore remains valid if further beliefs are added.
+             */
+            class BeliefView {
+            public:
+                class const_iterator {
+                public:
+                    const_iterator(BeliefManager const &manager, uint64_t position);
+                    std::pair<StateType, BeliefValueType const &> operator*() const;
+                    const_iterator &operator++();
+                    bool operator==(const_iterator const &other) const;
+                    bool operator!=(const_iterator const &other) const;
+
+                private:
+                    BeliefManager const *manager;
+                    uint64_t position;
+                };
+
+                BeliefView(BeliefManager const &manager, BeliefId const &id);
+                const_iterator begin() const;
+                const_iterator end() const;
+                uint64_t size() const;
+                StateType const &getFirstState() const;
+
+            private:
+                BeliefManager const &manager;
+                BeliefId id;
+            };
 
             struct BeliefHash {
                 std::size_t operator()(const BeliefType &belief) const;
@@ -83,44 +146,80 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            BeliefView getBelief(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
 
-            std::string toString(BeliefType const &belief) const;
+            template<typename BeliefRangeType>
+            std::string toString(BeliefRangeType const &belief) const;
 
-            bool isEqual(BeliefType const &first, BeliefType const &second) const;
+            template<typename FirstBeliefRangeType, typename SecondBeliefRangeType>
+            bool isEqual(FirstBeliefRangeType const &first, SecondBeliefRangeType const &second) const;
 
             bool assertBelief(BeliefType const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            bool assertTriangulation(BeliefType const &belief, GridTriangulation const &triangulation) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            uint32_t getBeliefObservation(BeliefType const &belief) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridTriangulation &result) const;
 
-            Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+            GridTriangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) const;
 
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
+            /*!
+             * Computes the (triangulated) successors of the given belief without modifying this manager, i.e. this can
+             * be called concurrently as long as no beliefs are added.
+             */
+            SuccessorBeliefs computeSuccessorBeliefs(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
+            /*!
+             * Assigns ids to the given successor beliefs (in the given order).
+             */
+            std::vector<std::pair<BeliefId, ValueType>> addSuccessorBeliefs(SuccessorBeliefs const &successors);
+
             BeliefId computeInitialBelief();
 
             BeliefId getOrAddBeliefId(BeliefType const &belief);
 
+            /*!
+             * Retrieves the slot of the lookup table that holds the id of the given belief or, if the belief is not
+             * stored, the empty slot at which its id is to be inserted.
+             */
+            uint64_t findSlot(BeliefType const &belief, std::size_t const &hash) const;
+
+            /*!
+             * Doubles the size of the lookup table and reinserts all stored beliefs (using their stored hashes).
+             */
+            void growLookupTable();
+
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            // All beliefs are stored once in a contiguous arena: the entries of the belief with id i are at positions
+            // beliefOffsets[i], ..., beliefOffsets[i + 1] - 1 of beliefStates and beliefValues.
+            std::vector<StateType> beliefStates;
+            std::vector<BeliefValueType> beliefValues;
+            std::vector<uint64_t> beliefOffsets;
+            std::vector<std::size_t> beliefHashes;
+            
+            // An open addressing hash table (with linear probing) of belief ids that indexes into the arena. Its size
+            // is a power of two and empty slots hold noId().
+            std::vector<BeliefId> beliefIdTable;
             BeliefId initialBeliefId;
             
             storm::utility::ConstantsComparator<ValueType> cc;
             
             TriangulationMode triangulationMode;
             
+            // The prefetched successors for each action of the prefetched beliefs and whether they are triangulated.
+            std::unordered_map<BeliefId, std::vector<SuccessorBeliefs>> prefetchedSuccessors;
+            bool prefetchedSuccessorsAreTriangulated;
+            
         };
     }
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/logic/Formulas.h"
 
 #include "storm/storage/jani/Edge.h"
@@ -30,6 +32,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
@@ -245,6 +248,9 @@ namespace storm {
             // All pairs of row/column meta variables.
             std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
             
+            // The pairs of row/column meta variables of the state variables in declaration order.
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> declarationOrderedMetaVariablePairs;
+            
             // A mapping from automata to the meta variables encoding their location.
             std::map<std::string, std::pair<storm::expressions::Variable, storm::expressions::Variable>> automatonToLocationDdVariableMap;
             
@@ -353,37 +359,54 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Gather the location variables and the non-transient variables (in declaration order).
+                std::vector<storm::expressions::Variable> stateVariables;
+                std::unordered_map<storm::expressions::Variable, storm::jani::Automaton const*> locationVariableToAutomatonMap;
+                std::unordered_map<storm::expressions::Variable, storm::jani::Variable const*> expressionVariableToVariableMap;
                 for (auto const& automatonName : this->automata) {
-                    storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
-                    
-                    // Start by creating a meta variable for the location of the automaton.
-                    storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
-                    result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
-                    result.rowColumnMetaVariablePairs.push_back(variablePair);
-
-                    result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
-                    result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
-                    
-                    // Add the location variable to the row/column variables.
-                    result.rowMetaVariables.insert(variablePair.first);
-                    result.columnMetaVariables.insert(variablePair.second);
-                    
-                    // Add the legal range for the location variables.
-                    result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
-                    result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+                    storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                    stateVariables.push_back(automaton.getLocationExpressionVariable());
+                    locationVariableToAutomatonMap.emplace(automaton.getLocationExpressionVariable(), &automaton);
+                }
+                for (auto const& variable : this->model.getGlobalVariables()) {
+                    if (!variable.isTransient()) {
+                        stateVariables.push_back(variable.getExpressionVariable());
+                        expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+                    }
+                }
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& variable : automaton.getVariables()) {
+                        if (!variable.isTransient()) {
+                            stateVariables.push_back(variable.getExpressionVariable());
+                            expressionVariableToVariableMap.emplace(variable.getExpressionVariable(), &variable);
+                        }
+                    }
                 }
                 
-                // Create global variables.
+                // Create the meta variables in the order given by the selected heuristic.
+                for (auto const& variable : computeVariableOrder(stateVariables)) {
+                    auto automatonIt = locationVariableToAutomatonMap.find(variable);
+                    if (automatonIt != locationVariableToAutomatonMap.end()) {
+                        createLocationVariable(*automatonIt->second, result);
+                    } else {
+                        createVariable(*expressionVariableToVariableMap.at(variable), result);
+                    }
+                }
+                for (auto const& variable : stateVariables) {
+                    auto automatonIt = locationVariableToAutomatonMap.find(variable);
+                    if (automatonIt != locationVariableToAutomatonMap.end()) {
+                        result.declarationOrderedMetaVariablePairs.push_back(result.automatonToLocationDdVariableMap.at(automatonIt->second->getName()));
+                    } else {
+                        result.declarationOrderedMetaVariablePairs.emplace_back(result.variableToRowMetaVariableMap->at(variable), result.variableToColumnMetaVariableMap->at(variable));
+                    }
+                }
+                
+                // Compute the ranges of the global variables.
                 storm::dd::Bdd<Type> globalVariableRanges = result.manager->getBddOne();
                 for (auto const& variable : this->model.getGlobalVariables()) {
-                    // Only create the variable if it's non-transient.
-                    if (variable.isTransient()) {
-                        continue;
+                    if (!variable.isTransient()) {
+                        globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
-                    
-                    createVariable(variable, result);
-                    globalVariableRanges &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                 }
                 result.globalVariableRanges = globalVariableRanges.template toAdd<ValueType>();
                 
@@ -398,14 +421,12 @@ namespace storm {
                     identity &= variableIdentity;
                     range &= result.manager->getRange(locationVariables.first);
                     
-                    // Then create variables for the variables of the automaton.
+                    // Then add the identities and ranges of the variables of the automaton.
                     for (auto const& variable : automaton.getVariables()) {
-                        // Only create the variable if it's non-transient.
                         if (variable.isTransient()) {
                             continue;
                         }
                         
-                        createVariable(variable, result);
                         identity &= result.variableToIdentityMap.at(variable.getExpressionVariable()).toBdd();
                         range &= result.manager->getRange(result.variableToRowMetaVariableMap->at(variable.getExpressionVariable()));
                     }
@@ -423,6 +444,51 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Orders the given state variables according to the heuristic selected in the build settings.
+             */
+            std::vector<storm::expressions::Variable> computeVariableOrder(std::vector<storm::expressions::Variable> const& stateVariables) const {
+                storm::builder::DdVariableOrdering ordering(stateVariables);
+                
+                // Every edge makes its source location and the variables of its guard and destinations interact.
+                for (auto const& automaton : this->model.getAutomata()) {
+                    for (auto const& edge : automaton.getEdges()) {
+                        std::set<storm::expressions::Variable> dependency = edge.getGuard().getVariables();
+                        dependency.insert(automaton.getLocationExpressionVariable());
+                        for (auto const& destination : edge.getDestinations()) {
+                            std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                            dependency.insert(probabilityVariables.begin(), probabilityVariables.end());
+                            for (auto const& assignment : destination.getOrderedAssignments()) {
+                                dependency.insert(assignment.getExpressionVariable());
+                                std::set<storm::expressions::Variable> assignmentVariables = assignment.getAssignedExpression().getVariables();
+                                dependency.insert(assignmentVariables.begin(), assignmentVariables.end());
+                            }
+                        }
+                        ordering.addDependency(dependency);
+                    }
+                }
+                
+                return ordering.computeOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic());
+            }
+            
+            void createLocationVariable(storm::jani::Automaton const& automaton, CompositionVariables<Type, ValueType>& result) {
+                storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
+                result.rowColumnMetaVariablePairs.push_back(variablePair);
+                
+                result.variableToRowMetaVariableMap->emplace(locationExpressionVariable, variablePair.first);
+                result.variableToColumnMetaVariableMap->emplace(locationExpressionVariable, variablePair.second);
+                
+                // Add the location variable to the row/column variables.
+                result.rowMetaVariables.insert(variablePair.first);
+                result.columnMetaVariables.insert(variablePair.second);
+                
+                // Add the legal range for the location variables.
+                result.variableToRangeMap.emplace(variablePair.first, result.manager->getRange(variablePair.first));
+                result.variableToRangeMap.emplace(variablePair.second, result.manager->getRange(variablePair.second));
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -1020,6 +1086,7 @@ namespace storm {
                         actions[ActionIdentification(actionInformation.getActionIndex(synchVector.getOutput()), this->model.getModelType() == storm::jani::ModelType::CTMC)].emplace_back(synchronizingAction.get());
                     }
                 }
+                this->variables.manager->checkMemoryBudget("composing the automata");
                 
                 // Construct the two silent action identifications.
                 ActionIdentification silentActionIdentification(storm::jani::Model::SILENT_ACTION_INDEX);
@@ -1108,7 +1175,10 @@ namespace storm {
             
             boost::optional<ActionDd> combineSynchronizingActions(std::vector<AutomatonDd> const& subautomata, storm::jani::SynchronizationVector const& synchronizationVector, uint64_t synchronizationVectorIndex) {
                 std::vector<std::pair<uint64_t, std::reference_wrapper<ActionDd const>>> actions;
-                storm::dd::Add<Type, ValueType> nonSynchronizingIdentity = this->variables.manager->template getAddOne<ValueType>();
+                
+                // Collect all factors of the synchronized transitions, so they can be multiplied in a balanced (and,
+                // if supported by the library, parallel) way.
+                std::vector<storm::dd::Add<Type, ValueType>> transitionFactors;
                 for (uint64_t subautomatonIndex = 0; subautomatonIndex < subautomata.size(); ++subautomatonIndex) {
                     auto const& subautomaton = subautomata[subautomatonIndex];
                     if (synchronizationVector.getInput(subautomatonIndex) != storm::jani::SynchronizationVector::NO_ACTION_INPUT) {
@@ -1119,7 +1189,7 @@ namespace storm {
                             return boost::none;
                         }
                     } else {
-                        nonSynchronizingIdentity *= subautomaton.identity;
+                        transitionFactors.push_back(subautomaton.identity);
                     }
                 }
                 
@@ -1143,7 +1213,6 @@ namespace storm {
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragmentWithoutNondeterminism;
                 
                 storm::dd::Bdd<Type> inputEnabledGuard = this->variables.manager->getBddOne();
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddOne<ValueType>();
                 
                 uint64_t lowestNondeterminismVariable = actions.front().second.get().getLowestLocalNondeterminismVariable();
                 uint64_t highestNondeterminismVariable = actions.front().second.get().getHighestLocalNondeterminismVariable();
@@ -1203,9 +1272,9 @@ namespace storm {
                     
                     if (action.isInputEnabled()) {
                         // If the action is input-enabled, we add self-loops to all states.
-                        transitions *= action.guard.ite(action.transitions, encodeIndex(0, action.getLowestLocalNondeterminismVariable(), action.getHighestLocalNondeterminismVariable() - action.getLowestLocalNondeterminismVariable(), this->variables) * subautomata[componentIndex].identity);
+                        transitionFactors.push_back(action.guard.ite(action.transitions, encodeIndex(0, action.getLowestLocalNondeterminismVariable(), action.getHighestLocalNondeterminismVariable() - action.getLowestLocalNondeterminismVariable(), this->variables) * subautomata[componentIndex].identity));
                     } else {
-                        transitions *= action.transitions;
+                        transitionFactors.push_back(action.transitions);
                     }
                     
                     // Create a set of variables that is used as nondeterminism variables in this action.
@@ -1252,7 +1321,7 @@ namespace storm {
                 // guards to make sure there are not transitions resulting from input enabledness alone.
                 if (allActionsInputEnabled) {
                     inputEnabledGuard &= guardDisjunction.get();
-                    transitions *= guardDisjunction.get().template toAdd<ValueType>();
+                    transitionFactors.push_back(guardDisjunction.get().template toAdd<ValueType>());
                 }
                 
                 // Cut the union of the illegal fragments to the conjunction of the guards since only these states have
@@ -1271,7 +1340,8 @@ namespace storm {
                     }
                 }
                 
-                return ActionDd(inputEnabledGuard, transitions * nonSynchronizingIdentity, transientEdgeAssignments, std::make_pair(lowestNondeterminismVariable, highestNondeterminismVariable), globalVariableToWritingFragment, illegalFragment);
+                storm::dd::Add<Type, ValueType> transitions = storm::dd::Add<Type, ValueType>::product(*this->variables.manager, transitionFactors);
+                return ActionDd(inputEnabledGuard, transitions, transientEdgeAssignments, std::make_pair(lowestNondeterminismVariable, highestNondeterminismVariable), globalVariableToWritingFragment, illegalFragment);
             }
             
             ActionDd combineUnsynchronizedActions(ActionDd action1, ActionDd action2, storm::dd::Add<Type, ValueType> const& identity1, storm::dd::Add<Type, ValueType> const& identity2) {
@@ -1328,7 +1398,8 @@ namespace storm {
                     
                     uint64_t numberOfLocalNondeterminismVariables = static_cast<uint64_t>(std::ceil(std::log2(actions.size())));
                     storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                    storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> encodedTransitions;
+                    encodedTransitions.reserve(actions.size());
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
@@ -1339,7 +1410,7 @@ namespace storm {
                         guard |= action.guard;
 
                         storm::dd::Add<Type, ValueType> nondeterminismEncoding = encodeIndex(actionIndex, highestLocalNondeterminismVariable, numberOfLocalNondeterminismVariables, this->variables);
-                        transitions += nondeterminismEncoding * action.transitions;
+                        encodedTransitions.push_back(nondeterminismEncoding * action.transitions);
                         
                         joinTransientAssignmentMapsInPlace(transientEdgeAssignments, action.transientEdgeAssignments, nondeterminismEncoding);
                         
@@ -1351,6 +1422,7 @@ namespace storm {
                         illegalFragment |= action.illegalFragment;
                     }
                     
+                    storm::dd::Add<Type, ValueType> transitions = storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, encodedTransitions);
                     return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair(lowestLocalNondeterminismVariable, highestLocalNondeterminismVariable + numberOfLocalNondeterminismVariables), variableToWritingFragment, illegalFragment);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::InvalidStateException, "Illegal model type.");
@@ -1422,10 +1494,12 @@ namespace storm {
                     }
                     
                     // Now combine the destination DDs to the edge DD.
-                    storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> destinationTransitions;
+                    destinationTransitions.reserve(destinationDds.size());
                     for (auto const& destinationDd : destinationDds) {
-                        transitions += destinationDd.transitions;
+                        destinationTransitions.push_back(destinationDd.transitions);
                     }
+                    storm::dd::Add<Type, ValueType> transitions = storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, destinationTransitions);
                     
                     // Add the source location and the guard.
                     storm::dd::Add<Type, ValueType> guardAdd = guard.template toAdd<ValueType>();
@@ -1465,7 +1539,8 @@ namespace storm {
             
             EdgeDd combineMarkovianEdgesToSingleEdge(std::vector<EdgeDd> const& edgeDds) {
                 storm::dd::Bdd<Type> guard = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
+                edgeTransitions.reserve(edgeDds.size());
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> variableToWritingFragment;
 
@@ -1478,7 +1553,7 @@ namespace storm {
                     }
                     
                     guard |= edge.guard;
-                    transitions += edge.transitions;
+                    edgeTransitions.push_back(edge.transitions);
                     variableToWritingFragment = joinVariableWritingFragmentMaps(variableToWritingFragment, edge.variableToWritingFragment);
                     joinTransientAssignmentMapsInPlace(transientEdgeAssignments, edge.transientEdgeAssignments);
                 }
@@ -1486,7 +1561,7 @@ namespace storm {
                 // Currently, we can only combine the transient edge assignments if there is no overlap of the guards of the edges.
                 STORM_LOG_THROW(!overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
                 
-                return EdgeDd(true, guard, transitions, transientEdgeAssignments, variableToWritingFragment);
+                return EdgeDd(true, guard, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, edgeTransitions), transientEdgeAssignments, variableToWritingFragment);
             }
             
             ActionDd buildActionDdForActionInstantiation(storm::jani::Automaton const& automaton, ActionInstantiation const& instantiation) {
@@ -1572,7 +1647,8 @@ namespace storm {
 
             ActionDd combineEdgesToActionDeterministic(std::vector<EdgeDd> const& edgeDds) {
                 storm::dd::Bdd<Type> allGuards = this->variables.manager->getBddZero();
-                storm::dd::Add<Type, ValueType> allTransitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
+                edgeTransitions.reserve(edgeDds.size());
                 storm::dd::Bdd<Type> temporary;
                 
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
@@ -1589,7 +1665,7 @@ namespace storm {
                     
                     // Add the elements of the current edge to the global ones.
                     allGuards |= edgeDd.guard;
-                    allTransitions += edgeDd.transitions;
+                    edgeTransitions.push_back(edgeDd.transitions);
                     
                     // Add the transient variable assignments to the resulting one. This transformation is illegal for
                     // CTMCs for which there is some overlap in edges that have some transient assignment (this needs to
@@ -1602,6 +1678,7 @@ namespace storm {
 
                 STORM_LOG_THROW(this->model.getModelType() == storm::jani::ModelType::DTMC || !overlappingGuards || transientEdgeAssignments.empty(), storm::exceptions::NotSupportedException, "Cannot have transient edge assignments when combining Markovian edges with overlapping guards.");
                 
+                storm::dd::Add<Type, ValueType> allTransitions = storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, edgeTransitions);
                 return ActionDd(allGuards, allTransitions, transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
             }
             
@@ -1636,12 +1713,13 @@ namespace storm {
             }
             
             ActionDd combineEdgesBySummation(storm::dd::Bdd<Type> const& guard, std::vector<EdgeDd> const& edges) {
-                storm::dd::Add<Type, ValueType> transitions = this->variables.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> edgeTransitions;
+                edgeTransitions.reserve(edges.size());
                 std::map<storm::expressions::Variable, storm::dd::Bdd<Type>> globalVariableToWritingFragment;
                 std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                 
                 for (auto const& edge : edges) {
-                    transitions += edge.transitions;
+                    edgeTransitions.push_back(edge.transitions);
                     for (auto const& assignment : edge.transientEdgeAssignments) {
                         addToTransientAssignmentMap(transientEdgeAssignments, assignment.first, assignment.second);
                     }
@@ -1650,7 +1728,7 @@ namespace storm {
                     }
                 }
                 
-                return ActionDd(guard, transitions, transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
+                return ActionDd(guard, storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, edgeTransitions), transientEdgeAssignments, std::make_pair<uint64_t, uint64_t>(0, 0), globalVariableToWritingFragment, this->variables.manager->getBddZero());
             }
             
             ActionDd combineEdgesToActionNondeterministic(std::vector<EdgeDd> const& edges, uint64_t localNondeterminismVariableOffset) {
@@ -1761,6 +1839,7 @@ namespace storm {
             
             AutomatonDd buildAutomatonDd(std::string const& automatonName, ActionInstantiations const& actionInstantiations, std::set<uint64_t> const& inputEnabledActionIndices, bool isTopLevelAutomaton) {
                 STORM_LOG_TRACE("Building DD for automaton '" << automatonName << "'.");
+                this->variables.manager->checkMemoryBudget("building the DD of automaton '" + automatonName + "'");
                 AutomatonDd result(this->variables.automatonToIdentityMap.at(automatonName));
                 
                 // Disjunction of all guards of non-markovian actions (only required for maximum progress assumption).
@@ -1836,7 +1915,7 @@ namespace storm {
                 
                 // If the model is an MDP, we need to encode the nondeterminism using additional variables.
                 if (modelType == storm::jani::ModelType::MDP || modelType == storm::jani::ModelType::MA || modelType == storm::jani::ModelType::LTS) {
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     
                     // First, determine the highest number of nondeterminism variables that is used in any action and make
@@ -1866,14 +1945,15 @@ namespace storm {
                             addToTransientAssignmentMap(transientEdgeAssignments, transientAssignment.first, actionEncoding * missingNondeterminismEncoding * transientAssignment.second);
                         }
                         
-                        result += extendedTransitions;
+                        actionTransitions.push_back(extendedTransitions);
                     }
                     
+                    storm::dd::Add<Type, ValueType> result = storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, actionTransitions);
                     return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
                 } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
-                    storm::dd::Add<Type, ValueType> result = this->variables.manager->template getAddZero<ValueType>();
+                    std::vector<storm::dd::Add<Type, ValueType>> actionTransitions;
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<uint64_t> actionIndices;
@@ -1883,9 +1963,10 @@ namespace storm {
                         illegalFragment |= action.second.illegalFragment;
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
-                        result += action.second.transitions;
+                        actionTransitions.push_back(action.second.transitions);
                     }
 
+                    storm::dd::Add<Type, ValueType> result = storm::dd::Add<Type, ValueType>::sum(*this->variables.manager, actionTransitions);
                     return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
@@ -2220,6 +2301,15 @@ namespace storm {
             // Build the reward models.
             modelComponents.rewardModels = buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, preparedModel.getModelType(), variables, system, rewardVariables);
             
+            storm::builder::DdVariableOrderingHeuristic orderingHeuristic = storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+            uint64_t transitionMatrixNodeCount = modelComponents.transitionMatrix.getNodeCount();
+            STORM_LOG_INFO("Transition matrix DD has " << transitionMatrixNodeCount << " nodes (variable order: " << orderingHeuristic << ").");
+            if (orderingHeuristic != storm::builder::DdVariableOrderingHeuristic::Declaration && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                // The DD may be considerably larger in declaration order, so it is only computed on request.
+                uint64_t declarationOrderNodeCount = storm::builder::getNodeCountForOrder(modelComponents.transitionMatrix, variables.declarationOrderedMetaVariablePairs);
+                STORM_PRINT_AND_LOG("Transition matrix DD has " << transitionMatrixNodeCount << " nodes with variable order '" << orderingHeuristic << "' and " << declarationOrderNodeCount << " nodes with variable order '" << storm::builder::DdVariableOrderingHeuristic::Declaration << "'." << std::endl);
+            }
+            
             // Finally, create the model.
             return createModel(preparedModel.getModelType(), variables, modelComponents);
         }
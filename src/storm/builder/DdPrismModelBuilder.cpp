@@ -2,6 +2,8 @@
 
 #include <boost/algorithm/string/join.hpp>
 
+#include "storm/builder/DdVariableOrdering.h"
+
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -25,6 +27,7 @@
 #include "storm/storage/dd/Bdd.h"
 
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -123,6 +126,9 @@ namespace storm {
             // All pairs of row/column meta variables.
             std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
             
+            // The pairs of row/column meta variables of the program variables in declaration order.
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> declarationOrderedMetaVariablePairs;
+            
             // The meta variables used to encode the nondeterminism.
             std::vector<storm::expressions::Variable> nondeterminismMetaVariables;
             
@@ -175,89 +181,98 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Gather all program variables (in declaration order) together with the bounds of the integer variables.
+                std::vector<storm::expressions::Variable> programVariables;
+                std::unordered_map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                    
-                    STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                    
-                    rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                    
-                    columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                    
-                    storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                    rowColumnMetaVariablePairs.push_back(variablePair);
-                    
+                    programVariables.push_back(integerVariable.getExpressionVariable());
+                    integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                    programVariables.push_back(booleanVariable.getExpressionVariable());
+                    allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+                }
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        programVariables.push_back(integerVariable.getExpressionVariable());
+                        integerVariableToBoundsMap.emplace(integerVariable.getExpressionVariable(), std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt()));
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                        programVariables.push_back(booleanVariable.getExpressionVariable());
+                    }
+                }
+                
+                // Create meta variables for the program variables in the order given by the selected heuristic.
+                for (storm::expressions::Variable const& variable : computeVariableOrder(programVariables)) {
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair;
+                    auto boundsIt = integerVariableToBoundsMap.find(variable);
+                    if (boundsIt != integerVariableToBoundsMap.end()) {
+                        variablePair = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                    } else {
+                        variablePair = manager->addMetaVariable(variable.getName());
+                    }
                     
-                    STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
+                    STORM_LOG_TRACE("Created meta variables for " << (allGlobalVariables.find(variable) != allGlobalVariables.end() ? "global " : "") << (boundsIt != integerVariableToBoundsMap.end() ? "integer" : "boolean") << " variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
                     rowMetaVariables.insert(variablePair.first);
-                    variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
+                    variableToRowMetaVariableMap->emplace(variable, variablePair.first);
                     
                     columnMetaVariables.insert(variablePair.second);
-                    variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
+                    variableToColumnMetaVariableMap->emplace(variable, variablePair.second);
                     
                     storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                    variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
+                    variableToIdentityMap.emplace(variable, variableIdentity.template toAdd<ValueType>());
                     
                     rowColumnMetaVariablePairs.push_back(variablePair);
-                    allGlobalVariables.insert(booleanVariable.getExpressionVariable());
+                }
+                for (storm::expressions::Variable const& variable : programVariables) {
+                    declarationOrderedMetaVariablePairs.emplace_back(variableToRowMetaVariableMap->at(variable), variableToColumnMetaVariableMap->at(variable));
                 }
                 
-                // Create meta variables for each of the modules' variables.
+                // Create the identities and ranges of the modules.
                 for (storm::prism::Module const& module : program.getModules()) {
                     storm::dd::Bdd<Type> moduleIdentity = manager->getBddOne();
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
-                        STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(integerVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(integerVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityMap.at(integerVariable.getExpressionVariable()).toBdd();
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(integerVariable.getExpressionVariable()));
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
-                        STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
-                        
-                        rowMetaVariables.insert(variablePair.first);
-                        variableToRowMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.first);
-                        
-                        columnMetaVariables.insert(variablePair.second);
-                        variableToColumnMetaVariableMap->emplace(booleanVariable.getExpressionVariable(), variablePair.second);
-                        
-                        storm::dd::Bdd<Type> variableIdentity = manager->getIdentity(variablePair.first, variablePair.second);
-                        variableToIdentityMap.emplace(booleanVariable.getExpressionVariable(), variableIdentity.template toAdd<ValueType>());
-                        moduleIdentity &= variableIdentity;
-                        moduleRange &= manager->getRange(variablePair.first);
-                        
-                        rowColumnMetaVariablePairs.push_back(variablePair);
+                        moduleIdentity &= variableToIdentityMap.at(booleanVariable.getExpressionVariable()).toBdd();
+                        moduleRange &= manager->getRange(variableToRowMetaVariableMap->at(booleanVariable.getExpressionVariable()));
                     }
                     moduleToIdentityMap[module.getName()] = moduleIdentity.template toAdd<ValueType>();
                     moduleToRangeMap[module.getName()] = moduleRange.template toAdd<ValueType>();
                 }
             }
+            
+            /*!
+             * Orders the given program variables according to the heuristic selected in the build settings.
+             */
+            std::vector<storm::expressions::Variable> computeVariableOrder(std::vector<storm::expressions::Variable> const& programVariables) const {
+                storm::builder::DdVariableOrdering ordering(programVariables);
+                
+                // Every command makes the variables of its guard and updates interact.
+                for (storm::prism::Module const& module : program.getModules()) {
+                    for (storm::prism::Command const& command : module.getCommands()) {
+                        std::set<storm::expressions::Variable> dependency = command.getGuardExpression().getVariables();
+                        for (storm::prism::Update const& update : command.getUpdates()) {
+                            std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                            dependency.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                            for (storm::prism::Assignment const& assignment : update.getAssignments()) {
+                                dependency.insert(assignment.getVariable());
+                                std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                                dependency.insert(assignmentVariables.begin(), assignmentVariables.end());
+                            }
+                        }
+                        ordering.addDependency(dependency);
+                    }
+                }
+                
+                return ordering.computeOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic());
+            }
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -534,6 +549,8 @@ namespace storm {
                 
                 // Keep track of the number of nondeterminism variables used.
                 left.numberOfUsedNondeterminismVariables = std::max(left.numberOfUsedNondeterminismVariables, numberOfUsedNondeterminismVariables);
+                
+                generationInfo.manager->checkMemoryBudget("composing the modules");
             }
             
             typename DdPrismModelBuilder<Type, ValueType>::GenerationInformation& generationInfo;
@@ -699,12 +716,14 @@ namespace storm {
                 }
                 
                 // Now combine the update DDs to the command DD.
-                storm::dd::Add<Type, ValueType> commandDd = generationInfo.manager->template getAddZero<ValueType>();
+                std::vector<storm::dd::Add<Type, ValueType>> weightedUpdateDds;
+                weightedUpdateDds.reserve(updateResults.size());
                 auto updateResultsIt = updateResults.begin();
                 for (auto updateIt = command.getUpdates().begin(), updateIte = command.getUpdates().end(); updateIt != updateIte; ++updateIt, ++updateResultsIt) {
                     storm::dd::Add<Type, ValueType> probabilityDd = generationInfo.rowExpressionAdapter->translateExpression(updateIt->getLikelihoodExpression());
-                    commandDd += updateResultsIt->updateDd * probabilityDd;
+                    weightedUpdateDds.push_back(updateResultsIt->updateDd * probabilityDd);
                 }
+                storm::dd::Add<Type, ValueType> commandDd = storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, weightedUpdateDds);
                 
                 return ActionDecisionDiagram(guard, guard.template toAdd<ValueType>() * commandDd, globalVariablesInSomeUpdate);
             } else {
@@ -795,7 +814,8 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram DdPrismModelBuilder<Type, ValueType>::combineCommandsToActionMarkovChain(GenerationInformation& generationInfo, std::vector<ActionDecisionDiagram>& commandDds) {
             storm::dd::Bdd<Type> allGuards = generationInfo.manager->getBddZero();
-            storm::dd::Add<Type, ValueType> allCommands = generationInfo.manager->template getAddZero<ValueType>();
+            std::vector<storm::dd::Add<Type, ValueType>> commandTransitions;
+            commandTransitions.reserve(commandDds.size());
             storm::dd::Bdd<Type> temporary;
             
             // Make all command DDs assign to the same global variables.
@@ -810,9 +830,10 @@ namespace storm {
                 STORM_LOG_WARN_COND(temporary.isZero() || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC, "Guard of a command overlaps with previous guards.");
                 
                 allGuards |= commandDd.guardDd;
-                allCommands += commandDd.transitionsDd;
+                commandTransitions.push_back(commandDd.transitionsDd);
             }
             
+            storm::dd::Add<Type, ValueType> allCommands = storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, commandTransitions);
             return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
         }
         
@@ -858,9 +879,12 @@ namespace storm {
                 return ActionDecisionDiagram(*generationInfo.manager);
             } else if (maxChoices == 1) {
                 // Sum up all commands.
+                std::vector<storm::dd::Add<Type, ValueType>> commandTransitions;
+                commandTransitions.reserve(commandDds.size());
                 for (auto const& commandDd : commandDds) {
-                    allCommands += commandDd.transitionsDd;
+                    commandTransitions.push_back(commandDd.transitionsDd);
                 }
+                allCommands = storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, commandTransitions);
                 return ActionDecisionDiagram(allGuards, allCommands, assignedGlobalVariables);
             } else {
                 // Calculate number of required variables to encode the nondeterminism.
@@ -1096,9 +1120,11 @@ namespace storm {
                 }
                 
                 // Now, we can simply add all synchronizing actions to the result.
+                std::vector<storm::dd::Add<Type, ValueType>> actionDds = {result};
                 for (auto const& synchronizingAction : synchronizingActionToDdMap) {
-                    result += synchronizingAction.second;
+                    actionDds.push_back(synchronizingAction.second);
                 }
+                result = storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, actionDds);
             } else if (generationInfo.program.getModelType() == storm::prism::Program::ModelType::DTMC || generationInfo.program.getModelType() == storm::prism::Program::ModelType::CTMC) {
                 // Simply add all actions, but make sure to include the missing global variable identities.
                 
@@ -1111,7 +1137,7 @@ namespace storm {
                     identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                 }
 
-                result = identityEncoding * module.independentAction.transitionsDd;
+                std::vector<storm::dd::Add<Type, ValueType>> actionDds = {identityEncoding * module.independentAction.transitionsDd};
                 for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
                     // Compute missing global variable identities in synchronizing actions.
                     missingIdentities = std::set<storm::expressions::Variable>();
@@ -1122,8 +1148,9 @@ namespace storm {
                         identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                     }
                     
-                    result += identityEncoding * synchronizingAction.second.transitionsDd;
+                    actionDds.push_back(identityEncoding * synchronizingAction.second.transitionsDd);
                 }
+                result = storm::dd::Add<Type, ValueType>::sum(*generationInfo.manager, actionDds);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
             }
@@ -1429,6 +1456,15 @@ namespace storm {
                 labelToExpressionMapping.emplace(label.getName(), label.getStatePredicateExpression());
             }
             
+            storm::builder::DdVariableOrderingHeuristic orderingHeuristic = storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrderingHeuristic();
+            uint64_t transitionMatrixNodeCount = transitionMatrix.getNodeCount();
+            STORM_LOG_INFO("Transition matrix DD has " << transitionMatrixNodeCount << " nodes (variable order: " << orderingHeuristic << ").");
+            if (orderingHeuristic != storm::builder::DdVariableOrderingHeuristic::Declaration && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                // The DD may be considerably larger in declaration order, so it is only computed on request.
+                uint64_t declarationOrderNodeCount = storm::builder::getNodeCountForOrder(transitionMatrix, generationInfo.declarationOrderedMetaVariablePairs);
+                STORM_PRINT_AND_LOG("Transition matrix DD has " << transitionMatrixNodeCount << " nodes with variable order '" << orderingHeuristic << "' and " << declarationOrderNodeCount << " nodes with variable order '" << storm::builder::DdVariableOrderingHeuristic::Declaration << "'." << std::endl);
+            }
+            
             std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result;
             if (program.getModelType() == storm::prism::Program::ModelType::DTMC) {
                 result = std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>>(new storm::models::symbolic::Dtmc<Type, ValueType>(generationInfo.manager, reachableStates, initialStates, deadlockStates, transitionMatrix, generationInfo.rowMetaVariables, generationInfo.rowExpressionAdapter, generationInfo.columnMetaVariables, generationInfo.rowColumnMetaVariablePairs, labelToExpressionMapping, rewardModels));
@@ -0,0 +1,150 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace builder {
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic) {
+            switch (heuristic) {
+                case DdVariableOrderingHeuristic::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrderingHeuristic::Force:
+                    out << "force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+
+        DdVariableOrdering::DdVariableOrdering(std::vector<storm::expressions::Variable> const& variables) : variables(variables) {
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                variableToIndexMap.emplace(variables[index], index);
+            }
+        }
+
+        void DdVariableOrdering::addDependency(std::set<storm::expressions::Variable> const& variables) {
+            std::vector<uint64_t> dependency;
+            for (auto const& variable : variables) {
+                auto it = variableToIndexMap.find(variable);
+                if (it != variableToIndexMap.end()) {
+                    dependency.push_back(it->second);
+                }
+            }
+
+            // Dependencies with less than two variables do not influence the order.
+            if (dependency.size() > 1) {
+                dependencies.push_back(std::move(dependency));
+            }
+        }
+
+        std::vector<storm::expressions::Variable> DdVariableOrdering::computeOrder(DdVariableOrderingHeuristic const& heuristic) const {
+            if (heuristic == DdVariableOrderingHeuristic::Declaration) {
+                return variables;
+            }
+            STORM_LOG_THROW(heuristic == DdVariableOrderingHeuristic::Force, storm::exceptions::InvalidArgumentException, "Unknown DD variable ordering heuristic '" << heuristic << "'.");
+
+            std::vector<uint64_t> positions = computeForcePositions();
+            std::vector<storm::expressions::Variable> result(variables.size());
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                result[positions[index]] = variables[index];
+            }
+
+            STORM_LOG_INFO("Ordering " << variables.size() << " state variables with heuristic '" << heuristic << "' changed the total dependency span from " << getTotalSpan(variables) << " (declaration order) to " << getTotalSpan(result) << ".");
+            return result;
+        }
+
+        uint64_t DdVariableOrdering::getTotalSpan(std::vector<storm::expressions::Variable> const& order) const {
+            std::vector<uint64_t> positions(variables.size());
+            for (uint64_t position = 0; position < order.size(); ++position) {
+                positions[variableToIndexMap.at(order[position])] = position;
+            }
+            return getTotalSpan(positions);
+        }
+
+        uint64_t DdVariableOrdering::getTotalSpan(std::vector<uint64_t> const& positions) const {
+            uint64_t result = 0;
+            for (auto const& dependency : dependencies) {
+                auto minMax = std::minmax_element(dependency.begin(), dependency.end(), [&positions] (uint64_t const& first, uint64_t const& second) { return positions[first] < positions[second]; });
+                result += positions[*minMax.second] - positions[*minMax.first];
+            }
+            return result;
+        }
+
+        std::vector<uint64_t> DdVariableOrdering::computeForcePositions() const {
+            uint64_t numberOfVariables = variables.size();
+
+            std::vector<std::vector<uint64_t>> variableToDependencies(numberOfVariables);
+            for (uint64_t dependencyIndex = 0; dependencyIndex < dependencies.size(); ++dependencyIndex) {
+                for (auto const& variableIndex : dependencies[dependencyIndex]) {
+                    variableToDependencies[variableIndex].push_back(dependencyIndex);
+                }
+            }
+
+            // Start from the declaration order.
+            std::vector<uint64_t> positions(numberOfVariables);
+            std::iota(positions.begin(), positions.end(), 0);
+            std::vector<uint64_t> bestPositions = positions;
+            uint64_t bestSpan = getTotalSpan(positions);
+
+            std::vector<double> centersOfGravity(dependencies.size());
+            std::vector<double> tentativePositions(numberOfVariables);
+            std::vector<uint64_t> order(numberOfVariables);
+
+            // FORCE converges quickly, so we bound the number of iterations and stop as soon as the span does not
+            // improve anymore.
+            uint64_t const maximalNumberOfIterations = 100;
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+                // Compute the center of gravity of every dependency.
+                for (uint64_t dependencyIndex = 0; dependencyIndex < dependencies.size(); ++dependencyIndex) {
+                    double sum = 0;
+                    for (auto const& variableIndex : dependencies[dependencyIndex]) {
+                        sum += positions[variableIndex];
+                    }
+                    centersOfGravity[dependencyIndex] = sum / dependencies[dependencyIndex].size();
+                }
+
+                // Move every variable to the average center of gravity of its dependencies.
+                for (uint64_t variableIndex = 0; variableIndex < numberOfVariables; ++variableIndex) {
+                    if (variableToDependencies[variableIndex].empty()) {
+                        tentativePositions[variableIndex] = positions[variableIndex];
+                    } else {
+                        double sum = 0;
+                        for (auto const& dependencyIndex : variableToDependencies[variableIndex]) {
+                            sum += centersOfGravity[dependencyIndex];
+                        }
+                        tentativePositions[variableIndex] = sum / variableToDependencies[variableIndex].size();
+                    }
+                }
+
+                // Derive the new order by sorting the tentative positions (breaking ties by the old positions).
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [&tentativePositions, &positions] (uint64_t const& first, uint64_t const& second) {
+                    return tentativePositions[first] < tentativePositions[second] || (tentativePositions[first] == tentativePositions[second] && positions[first] < positions[second]);
+                });
+                for (uint64_t position = 0; position < numberOfVariables; ++position) {
+                    positions[order[position]] = position;
+                }
+
+                uint64_t span = getTotalSpan(positions);
+                STORM_LOG_TRACE("FORCE iteration " << iteration << " yields total span " << span << ".");
+                if (span < bestSpan) {
+                    bestSpan = span;
+                    bestPositions = positions;
+                } else {
+                    break;
+                }
+            }
+
+            return bestPositions;
+        }
+
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef STORM_BUILDER_DDVARIABLEORDERING_H_
+#define STORM_BUILDER_DDVARIABLEORDERING_H_
+
+#include <algorithm>
+#include <ostream>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace builder {
+
+        // An enum that contains all currently supported heuristics to order the state variables of a DD-based model.
+        enum class DdVariableOrderingHeuristic { Declaration, Force };
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrderingHeuristic const& heuristic);
+
+        /*!
+         * A helper class that statically computes an order of the state variables before the DD (meta) variables are
+         * created. Variables that jointly occur in some dependency (e.g. the guard and updates of a command) are
+         * considered to interact and are placed close to each other.
+         */
+        class DdVariableOrdering {
+        public:
+            /*!
+             * Creates an ordering helper for the given variables.
+             *
+             * @param variables The variables to order (in declaration order).
+             */
+            DdVariableOrdering(std::vector<storm::expressions::Variable> const& variables);
+
+            /*!
+             * Records that the given variables interact. Variables that are not among the ones to order are ignored.
+             *
+             * @param variables The interacting variables.
+             */
+            void addDependency(std::set<storm::expressions::Variable> const& variables);
+
+            /*!
+             * Computes an order of the variables using the given heuristic.
+             *
+             * @param heuristic The heuristic to use.
+             * @return The variables in the order in which their DD variables should be created.
+             */
+            std::vector<storm::expressions::Variable> computeOrder(DdVariableOrderingHeuristic const& heuristic) const;
+
+            /*!
+             * Computes the total span of the given order, i.e. the sum over all dependencies of the distance between
+             * the first and the last variable of the dependency. Smaller spans tend to yield smaller DDs.
+             *
+             * @param order The order of the variables.
+             * @return The total span of the order.
+             */
+            uint64_t getTotalSpan(std::vector<storm::expressions::Variable> const& order) const;
+
+        private:
+            /*!
+             * Computes the positions of the variables using the FORCE heuristic (Aloul, Markov, Sakallah: "FORCE: A
+             * Fast and Easy-To-Implement Variable-Ordering Heuristic", GLSVLSI 2003).
+             *
+             * @return The position of each variable.
+             */
+            std::vector<uint64_t> computeForcePositions() const;
+
+            /*!
+             * Computes the total span of the dependencies given the positions of the variables.
+             */
+            uint64_t getTotalSpan(std::vector<uint64_t> const& positions) const;
+
+            // The variables to order in declaration order.
+            std::vector<storm::expressions::Variable> variables;
+
+            // A mapping from the variables to their indices in declaration order.
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndexMap;
+
+            // The dependencies between the variables (given by variable indices).
+            std::vector<std::vector<uint64_t>> dependencies;
+        };
+
+        /*!
+         * Computes the number of nodes the given DD would have if the given row/column meta variable pairs had been
+         * created in the given order. For this, the DD variables of the given meta variables are redistributed (in the
+         * given order, row and column variables interleaved) over the levels they currently occupy and the node count
+         * of the permuted DD is taken. No meta variables are added to the manager.
+         *
+         * @param dd The DD.
+         * @param metaVariablePairs The row/column meta variable pairs in the order to consider.
+         * @return The number of nodes of the DD under the given order.
+         */
+        template<storm::dd::DdType Type, typename ValueType>
+        uint64_t getNodeCountForOrder(storm::dd::Add<Type, ValueType> const& dd, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& metaVariablePairs) {
+            storm::dd::DdManager<Type> const& manager = dd.getDdManager();
+            std::vector<storm::dd::Bdd<Type>> orderedDdVariables;
+            for (auto const& metaVariablePair : metaVariablePairs) {
+                std::vector<storm::dd::Bdd<Type>> const& rowDdVariables = manager.getMetaVariable(metaVariablePair.first).getDdVariables();
+                std::vector<storm::dd::Bdd<Type>> const& columnDdVariables = manager.getMetaVariable(metaVariablePair.second).getDdVariables();
+                for (uint64_t bit = 0; bit < rowDdVariables.size(); ++bit) {
+                    orderedDdVariables.push_back(rowDdVariables[bit]);
+                    orderedDdVariables.push_back(columnDdVariables[bit]);
+                }
+            }
+
+            // The i-th variable of the requested order is moved to the i-th smallest level among the involved variables.
+            std::vector<storm::dd::Bdd<Type>> levelSortedDdVariables = orderedDdVariables;
+            std::sort(levelSortedDdVariables.begin(), levelSortedDdVariables.end(), [] (storm::dd::Bdd<Type> const& first, storm::dd::Bdd<Type> const& second) { return first.getLevel() < second.getLevel(); });
+
+            std::vector<storm::dd::InternalBdd<Type>> from;
+            std::vector<storm::dd::InternalBdd<Type>> to;
+            for (uint64_t index = 0; index < orderedDdVariables.size(); ++index) {
+                from.push_back(orderedDdVariables[index].getInternalBdd());
+                to.push_back(levelSortedDdVariables[index].getInternalBdd());
+            }
+            return dd.getInternalAdd().permuteVariables(from, to).getNodeCount();
+        }
+
+    }
+}
+
+#endif /* STORM_BUILDER_DDVARIABLEORDERING_H_ */
@@ -27,6 +27,10 @@ namespace storm {
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        bool isAdaptiveConvergenceCheckSet() const;
+        void setAdaptiveConvergenceCheck(bool value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -36,6 +40,8 @@ namespace storm {
         bool considerRelativeTerminationCriterion;
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool symmetricUpdates;
+        bool mixedPrecision;
+        bool adaptiveConvergenceCheck;
     };
 }
 
@@ -11,6 +11,7 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        numaAwarePlacement = multiplierSettings.isNumaAwarePlacementSet();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +31,12 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool MultiplierEnvironment::isNumaAwarePlacementSet() const {
+        return numaAwarePlacement;
+    }
+    
+    void MultiplierEnvironment::setNumaAwarePlacement(bool value) {
+        numaAwarePlacement = value;
+    }
+    
 }
@@ -14,10 +14,13 @@ namespace storm {
         storm::solver::MultiplierType const& getType() const;
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+        bool isNumaAwarePlacementSet() const;
+        void setNumaAwarePlacement(bool value);
         
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool numaAwarePlacement;
     };
 }
 
@@ -22,7 +22,11 @@ namespace storm {
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || nativeSettings.getConvergenceCriterion() == storm::settings::modules::NativeEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
         powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
+        preconditioner = nativeSettings.getPreconditioningMethod();
+        restartThreshold = nativeSettings.getRestartIterationCount();
         symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        mixedPrecision = nativeSettings.isMixedPrecisionSet();
+        adaptiveConvergenceCheck = nativeSettings.isAdaptiveConvergenceCheckSet();
 
     }
 
@@ -82,6 +86,22 @@ namespace storm {
     void NativeSolverEnvironment::setSorOmega(storm::RationalNumber const& value) {
         sorOmega = value;
     }
+    
+    storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+        return preconditioner;
+    }
+    
+    void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+        preconditioner = value;
+    }
+    
+    uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+        return restartThreshold;
+    }
+    
+    void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+        restartThreshold = value;
+    }
 
     bool NativeSolverEnvironment::isSymmetricUpdatesSet() const {
         return symmetricUpdates;
@@ -90,5 +110,21 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    bool NativeSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void NativeSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
+    bool NativeSolverEnvironment::isAdaptiveConvergenceCheckSet() const {
+        return adaptiveConvergenceCheck;
+    }
+    
+    void NativeSolverEnvironment::setAdaptiveConvergenceCheck(bool value) {
+        adaptiveConvergenceCheck = value;
+    }
   
 }
@@ -27,8 +27,16 @@ namespace storm {
         void setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle value);
         storm::RationalNumber const& getSorOmega() const;
         void setSorOmega(storm::RationalNumber const& value);
+        storm::solver::NativeLinearEquationSolverPreconditioner const& getPreconditioner() const;
+        void setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value);
+        uint64_t const& getRestartThreshold() const;
+        void setRestartThreshold(uint64_t value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        bool isAdaptiveConvergenceCheckSet() const;
+        void setAdaptiveConvergenceCheck(bool value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -38,7 +46,11 @@ namespace storm {
         bool considerRelativeTerminationCriterion;
         storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
         storm::RationalNumber sorOmega;
+        storm::solver::NativeLinearEquationSolverPreconditioner preconditioner;
+        uint64_t restartThreshold;
         bool symmetricUpdates;
+        bool mixedPrecision;
+        bool adaptiveConvergenceCheck;
     };
 }
 
@@ -19,6 +19,7 @@ namespace storm {
         forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
         linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
         linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+        symbolicExplicitFallbackThreshold = storm::settings::getModule<storm::settings::modules::CoreSettings>().getDdExplicitFallbackThreshold();
     }
     
     SolverEnvironment::~SolverEnvironment() {
@@ -121,6 +122,14 @@ namespace storm {
         SolverEnvironment::forceExact = value;
     }
     
+    uint64_t const& SolverEnvironment::getSymbolicExplicitFallbackThreshold() const {
+        return symbolicExplicitFallbackThreshold;
+    }
+    
+    void SolverEnvironment::setSymbolicExplicitFallbackThreshold(uint64_t value) {
+        symbolicExplicitFallbackThreshold = value;
+    }
+    
     storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
         return linearEquationSolverType;
     }
@@ -53,6 +53,8 @@ namespace storm {
         void setForceSoundness(bool value);
         bool isForceExact() const;
         void setForceExact(bool value);
+        uint64_t const& getSymbolicExplicitFallbackThreshold() const;
+        void setSymbolicExplicitFallbackThreshold(uint64_t value);
         
         storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
         void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
@@ -77,6 +79,7 @@ namespace storm {
         bool linearEquationSolverTypeSetFromDefault;
         bool forceSoundness;
         bool forceExact;
+        uint64_t symbolicExplicitFallbackThreshold;
     };
 }
 
@@ -58,7 +58,7 @@ namespace storm {
                     // Forward this query to the sparse engine
                     storm::utility::Stopwatch conversionWatch(true);
                     storm::dd::Odd odd = model.getReachableStates().createOdd();
-                    storm::storage::SparseMatrix<ValueType> explicitRateMatrix = rateMatrix.toMatrix(odd, odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitRateMatrix = model.getExplicitMatrix(rateMatrix, model.getReachableStates());
                     std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
                     storm::solver::SolveGoal<ValueType> goal;
                     if (onlyInitialStatesRelevant) {
@@ -67,7 +67,7 @@ namespace storm {
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<ValueType>(env, std::move(goal), explicitRateMatrix, explicitRateMatrix.transpose(true), phiStates.toVector(odd), psiStates.toVector(odd), explicitExitRateVector, qualitative, lowerBound, upperBound);
+                    std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities<ValueType>(env, std::move(goal), *explicitRateMatrix, explicitRateMatrix->transpose(true), phiStates.toVector(odd), psiStates.toVector(odd), explicitExitRateVector, qualitative, lowerBound, upperBound);
 
                     return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
                 }
@@ -110,14 +110,14 @@ namespace storm {
                             storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
                             
                             // Convert the symbolic parts to their explicit representation.
-                            storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, statesWithProbabilityGreater0NonPsi);
                             std::vector<ValueType> explicitB = b.toVector(odd);
                             conversionWatch.stop();
                             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                             
                             // Finally compute the transient probabilities.
                             std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
-                            std::vector<ValueType> subresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, explicitUniformizedMatrix, &explicitB, upperBound, uniformizationRate, values, epsilon);
+                            std::vector<ValueType> subresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, *explicitUniformizedMatrix, &explicitB, upperBound, uniformizationRate, values, epsilon);
                             
                             return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(),
                                                                                                           (psiStates || !statesWithProbabilityGreater0) && model.getReachableStates(),
@@ -159,12 +159,12 @@ namespace storm {
                             // Compute the uniformized matrix.
                             storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
                             conversionWatch.start();
-                            storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, relevantStates);
                             conversionWatch.stop();
                             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                             // Compute the transient probabilities.
-                            result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, result, epsilon);
+                            result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, result, epsilon);
                             
                             return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !relevantStates && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), relevantStates, odd, result));
                         } else {
@@ -186,13 +186,13 @@ namespace storm {
                                 // Build an ODD for the relevant states and translate the symbolic parts to their explicit representation.
                                 storm::utility::Stopwatch conversionWatch(true);
                                 storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
-                                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, statesWithProbabilityGreater0NonPsi);
                                 std::vector<ValueType> explicitB = b.toVector(odd);
                                 conversionWatch.stop();
 
                                 // Compute the transient probabilities.
                                 std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
-                                std::vector<ValueType> subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values, epsilon);
+                                std::vector<ValueType> subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, *explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values, epsilon);
                                 
                                 // Transform the explicit result to a hybrid check result, so we can easily convert it to
                                 // a symbolic qualitative format.
@@ -228,11 +228,11 @@ namespace storm {
                                 // Finally, we compute the second set of transient probabilities.
                                 uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
                                 conversionWatch.start();
-                                explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, relevantStates);
                                 conversionWatch.stop();
                                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
+                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
                                 
                                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !relevantStates && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), relevantStates, odd, newSubresult));
                             } else {
@@ -255,11 +255,11 @@ namespace storm {
                                 // Finally, we compute the second set of transient probabilities.
                                 storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0, uniformizationRate);
                                 conversionWatch.start();
-                                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, statesWithProbabilityGreater0);
                                 conversionWatch.stop();
                                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
+                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult, epsilon);
                                 
                                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !statesWithProbabilityGreater0 && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), statesWithProbabilityGreater0, odd, newSubresult));
                             }
@@ -301,7 +301,7 @@ namespace storm {
                     storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
                     
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, model.getReachableStates());
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
@@ -324,7 +324,7 @@ namespace storm {
                     
                     // Loop until the desired precision is reached.
                     do {
-                        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, result, epsilon);
+                        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, result, epsilon);
                     } while (storm::modelchecker::helper::SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
                 }
                 
@@ -362,7 +362,7 @@ namespace storm {
                 // Compute the uniformized matrix.
                 storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector,  model.getReachableStates(), uniformizationRate);
                 conversionWatch.start();
-                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitMatrix(uniformizedMatrix, model.getReachableStates());
                 conversionWatch.stop();
                 
                 // Then compute the state reward vector to use in the computation.
@@ -400,7 +400,7 @@ namespace storm {
                 // Finally, compute the transient probabilities.
                 // Loop until the desired precision is reached.
                 do {
-                    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType, true>(env, explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, explicitTotalRewardVector, epsilon);
+                    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType, true>(env, *explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, explicitTotalRewardVector, epsilon);
                 } while (storm::modelchecker::helper::SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result, relevantValues));
                 
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
@@ -46,6 +46,12 @@ namespace storm {
                 }
             }
 
+            template <typename ValueType>
+            bool SparseDeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentComputationSupported(Environment const&) const {
+                // The BSCCs are analyzed using linear equation solvers or value iteration which do not share any state.
+                return true;
+            }
+
             template <typename ValueType>
             ValueType SparseDeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateValueGetter, ValueGetter const& actionValueGetter, storm::storage::StronglyConnectedComponent const& component) {
                 // For deterministic models, we compute the LRA for a BSCC
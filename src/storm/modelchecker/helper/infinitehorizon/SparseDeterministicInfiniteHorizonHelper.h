@@ -43,6 +43,8 @@ namespace storm {
                 
                 virtual void createDecomposition() override;
                 
+                virtual bool isParallelComponentComputationSupported(Environment const& env) const override;
+                
                 std::pair<bool, ValueType> computeLraForTrivialBscc(Environment const& env, ValueGetter const& stateValuesGetter,  ValueGetter const& actionValuesGetter, storm::storage::StronglyConnectedComponent const& bscc);
                 
                 /*!
@@ -20,6 +20,15 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/ProgressMeasurement.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 
@@ -141,12 +150,39 @@ namespace storm {
                 progress.setMaxCount( _longRunComponentDecomposition->size());
                 progress.startNewMeasurement(0);
                 STORM_LOG_INFO("Computing long run average values for " << _longRunComponentDecomposition->size() << " " << componentString << " individually...");
-                std::vector<ValueType> componentLraValues;
-                componentLraValues.reserve(_longRunComponentDecomposition->size());
-                for (auto const& c : *_longRunComponentDecomposition) {
-                    componentLraValues.push_back(computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, c));
-                    progress.updateProgress(componentLraValues.size());
+                std::vector<ValueType> componentLraValues(_longRunComponentDecomposition->size());
+#ifdef STORM_HAVE_INTELTBB
+                // Components are independent of each other, so we can process them concurrently. We restrict this to floating point
+                // arithmetic as the computations with (carl) rational numbers and functions are not thread-safe.
+                bool parallelize = std::is_same<ValueType, double>::value && _longRunComponentDecomposition->size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && isParallelComponentComputationSupported(underlyingSolverEnvironment);
+                if (parallelize) {
+                    STORM_LOG_INFO("Processing the " << componentString << " in parallel.");
+                    // Every thread uses its own copy of the environment. As the value of each component is stored at the index of the component,
+                    // the result does not depend on how the components are distributed among the threads.
+                    tbb::enumerable_thread_specific<Environment> threadEnvironments(underlyingSolverEnvironment);
+                    std::atomic<uint64_t> numberOfProcessedComponents(0);
+                    std::mutex progressMutex;
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, _longRunComponentDecomposition->size()), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        Environment const& threadEnvironment = threadEnvironments.local();
+                        for (uint64_t componentIndex = range.begin(); componentIndex < range.end(); ++componentIndex) {
+                            componentLraValues[componentIndex] = computeLraForComponent(threadEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+                            uint64_t processedComponents = ++numberOfProcessedComponents;
+                            // Only report progress if no other thread does so at the moment.
+                            std::unique_lock<std::mutex> progressLock(progressMutex, std::try_to_lock);
+                            if (progressLock.owns_lock()) {
+                                progress.updateProgress(processedComponents);
+                            }
+                        }
+                    });
+                } else {
+#endif
+                    for (uint64_t componentIndex = 0; componentIndex < _longRunComponentDecomposition->size(); ++componentIndex) {
+                        componentLraValues[componentIndex] = computeLraForComponent(underlyingSolverEnvironment, stateRewardsGetter, actionRewardsGetter, (*_longRunComponentDecomposition)[componentIndex]);
+                        progress.updateProgress(componentIndex + 1);
+                    }
+#ifdef STORM_HAVE_INTELTBB
                 }
+#endif
                 
                 // Solve the resulting SSP where end components are collapsed into single auxiliary states
                 STORM_LOG_INFO("Solving stochastic shortest path problem.");
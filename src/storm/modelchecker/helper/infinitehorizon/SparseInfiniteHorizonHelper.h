@@ -115,6 +115,11 @@ namespace storm {
                  */
                 virtual void createDecomposition() = 0;
                 
+                /*!
+                 * @return true iff the LRA values of different components can be computed concurrently (using separate copies of the given environment)
+                 */
+                virtual bool isParallelComponentComputationSupported(Environment const& env) const = 0;
+                
                 /*!
                  * @pre if scheduler production is enabled and Nondeterministic is true, a choice for each state within a component must be set such that the choices yield optimal values w.r.t. the individual components.
                  * @return Lra values for each state
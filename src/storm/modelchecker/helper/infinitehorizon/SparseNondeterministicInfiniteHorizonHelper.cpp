@@ -70,6 +70,19 @@ namespace storm {
                 }
             }
 
+            template <typename ValueType>
+            bool SparseNondeterministicInfiniteHorizonHelper<ValueType>::isParallelComponentComputationSupported(Environment const& env) const {
+                // LP solvers are not necessarily thread-safe, so we only process MECs concurrently if they are analyzed with value iteration.
+                if (env.solver().isForceExact()) {
+                    return false;
+                }
+                storm::solver::LraMethod method = env.solver().lra().getNondetLraMethod();
+                if (env.solver().isForceSoundness() && env.solver().lra().isNondetLraMethodSetFromDefault()) {
+                    method = storm::solver::LraMethod::ValueIteration;
+                }
+                return method == storm::solver::LraMethod::ValueIteration;
+            }
+
             template <typename ValueType>
             ValueType SparseNondeterministicInfiniteHorizonHelper<ValueType>::computeLraForComponent(Environment const& env, ValueGetter const& stateRewardsGetter, ValueGetter const& actionRewardsGetter, storm::storage::MaximalEndComponent const& component) {
                 // For models with potential nondeterminisim, we compute the LRA for a maximal end component (MEC)
@@ -79,7 +92,10 @@ namespace storm {
                     if (!this->_producedOptimalChoices.is_initialized()) {
                         this->_producedOptimalChoices.emplace();
                     }
-                    this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    // Only resize if necessary as components might be processed concurrently.
+                    if (this->_producedOptimalChoices->size() != this->_transitionMatrix.getRowGroupCount()) {
+                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                    }
                 }
                 
                 auto trivialResult = this->computeLraForTrivialMec(env, stateRewardsGetter, actionRewardsGetter, component);
@@ -89,12 +89,12 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitMatrix(submatrix, maybeStates);
                         std::vector<ValueType> b = subvector.toVector(odd);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                         
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitSubmatrix);
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                         solver->solveEquations(env, x, b);
                         
@@ -157,12 +157,12 @@ namespace storm {
                     
                     // Translate the symbolic matrix/vector to their explicit representations.
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitMatrix(submatrix, maybeStates);
                     std::vector<ValueType> b = subvector.toVector(odd);
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitSubmatrix);
                     multiplier->repeatedMultiply(env, x, &b, stepBound);
 
                     // Return a hybrid check result that stores the numerical values explicitly.
@@ -186,12 +186,12 @@ namespace storm {
                 std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
                 
                 // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getExplicitMatrix(transitionMatrix, model.getReachableStates());
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiply(env, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -215,13 +215,13 @@ namespace storm {
                 storm::dd::Odd odd = model.getReachableStates().createOdd();
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getExplicitMatrix(transitionMatrix, model.getReachableStates());
                 std::vector<ValueType> b = totalRewardVector.toVector(odd);
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiply(env, x, &b, stepBound);
                 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -309,7 +309,7 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitMatrix(submatrix, maybeStates);
                         std::vector<ValueType> b = subvector.toVector(odd);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -319,11 +319,11 @@ namespace storm {
                         if (oneStepTargetProbs) {
                             // FIXME: This will fail if we already converted the matrix to the equation problem format.
                             STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
-                            upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
+                            upperBounds = computeUpperRewardBounds(*explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
                         }
                         
                         // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, *explicitSubmatrix);
                         solver->setLowerBound(storm::utility::zero<ValueType>());
                         if (upperBounds) {
                             solver->setUpperBounds(std::move(upperBounds.get()));
@@ -13,6 +13,9 @@
 
 #include "storm/adapters/AddExpressionAdapter.h"
 
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/dd/Odd.h"
+
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/utility/constants.h"
@@ -164,6 +167,25 @@ namespace storm {
                 return transitionMatrix;
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<Type, ValueType>::getExplicitMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states) const {
+                // DDs are canonical, so comparing them is cheap.
+                std::shared_ptr<ExplicitMatrixCacheEntry const> cacheEntry = std::atomic_load(&explicitMatrixCache);
+                if (cacheEntry && cacheEntry->matrix == matrix && cacheEntry->states == states) {
+                    STORM_LOG_TRACE("Reusing explicit matrix with " << cacheEntry->explicitMatrix->getEntryCount() << " entries.");
+                    return cacheEntry->explicitMatrix;
+                }
+                storm::dd::Odd odd = states.createOdd();
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> result = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(matrix.toMatrix(odd, odd));
+                std::atomic_store(&explicitMatrixCache, std::shared_ptr<ExplicitMatrixCacheEntry const>(new ExplicitMatrixCacheEntry{matrix, states, result}));
+                return result;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            void Model<Type, ValueType>::clearExplicitMatrixCache() const {
+                std::atomic_store(&explicitMatrixCache, std::shared_ptr<ExplicitMatrixCacheEntry const>());
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType>& Model<Type, ValueType>::getTransitionMatrix() {
                 return transitionMatrix;
@@ -33,6 +33,11 @@ namespace storm {
         class AddExpressionAdapter;
     }
     
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+    
     namespace models {
         namespace symbolic {
             
@@ -199,6 +204,23 @@ namespace storm {
                  * @return A matrix representing the transitions of the model.
                  */
                 storm::dd::Add<Type, ValueType>& getTransitionMatrix();
+                
+                /*!
+                 * Retrieves the explicit representation of the given matrix restricted to the given states, i.e. the
+                 * matrix obtained by translating the DD using the ODD of the given states for both rows and columns.
+                 * The most recently translated matrix is cached, so checking several properties that need the same
+                 * matrix only translates it once. The returned matrix is shared with the cache and must not be modified.
+                 *
+                 * @param matrix A matrix over the row and column variables of this model.
+                 * @param states The states (over the row variables) whose ODD determines the rows and columns.
+                 * @return The explicit matrix.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getExplicitMatrix(storm::dd::Add<Type, ValueType> const& matrix, storm::dd::Bdd<Type> const& states) const;
+                
+                /*!
+                 * Releases the cached explicit matrix (if any). Matrices that were already retrieved remain valid.
+                 */
+                void clearExplicitMatrixCache() const;
 
                 /*!
                  * Retrieves the matrix qualitatively (i.e. without probabilities) representing the transitions of the
@@ -443,6 +465,17 @@ namespace storm {
                 
                 // An empty variable set that can be used when references to non-existing sets need to be returned.
                 std::set<storm::expressions::Variable> emptyVariableSet;
+                
+                struct ExplicitMatrixCacheEntry {
+                    // The matrix DD and the states for which the explicit matrix was requested.
+                    storm::dd::Add<Type, ValueType> matrix;
+                    storm::dd::Bdd<Type> states;
+                    
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+                };
+                
+                // The most recently requested explicit matrix. Entries are immutable and only exchanged atomically.
+                mutable std::shared_ptr<ExplicitMatrixCacheEntry const> explicitMatrixCache;
             };
             
         } // namespace symbolic
@@ -13,6 +13,7 @@ namespace storm {
     namespace settings {
         namespace modules {
             class BuildSettings;
+            class CoreSettings;
             class ModuleSettings;
             class AbstractionSettings;
         }
@@ -319,6 +320,14 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the core settings.
+         */
+        storm::settings::modules::CoreSettings& mutableCoreSettings();
+        
     } // namespace settings
 } // namespace storm
 
@@ -37,6 +37,7 @@ namespace storm {
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string ddVariableOrderingOptionName = "ddvarorder";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -59,6 +60,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                std::vector<std::string> ddVariableOrderings = {"declaration", "force"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets the heuristic that orders the state variables before building a symbolic (DD-based) model.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. 'declaration' keeps the order of the input, 'force' places interacting variables close to each other.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings)).setDefaultValueString("declaration").build()).build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -135,6 +139,16 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            storm::builder::DdVariableOrderingHeuristic BuildSettings::getDdVariableOrderingHeuristic() const {
+                std::string heuristicAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (heuristicAsString == "declaration") {
+                    return storm::builder::DdVariableOrderingHeuristic::Declaration;
+                } else if (heuristicAsString == "force") {
+                    return storm::builder::DdVariableOrderingHeuristic::Force;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable ordering heuristic '" << heuristicAsString << "'.");
+            }
+
         }
 
 
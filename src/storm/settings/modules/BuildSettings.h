@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 namespace storm {
     namespace settings {
@@ -115,6 +116,13 @@ namespace storm {
                  * @return
                  */
                 uint64_t getBitsForUnboundedVariables() const;
+
+                /*!
+                 * Retrieves the heuristic used to order the state variables of symbolic (DD-based) models.
+                 *
+                 * @return The chosen heuristic.
+                 */
+                storm::builder::DdVariableOrderingHeuristic getDdVariableOrderingHeuristic() const;
                 
                 /*!
                  * Retrieves whether simplification of symbolic inputs through static analysis shall be disabled
@@ -28,6 +28,7 @@ namespace storm {
             const std::string CoreSettings::engineOptionName = "engine";
             const std::string CoreSettings::engineOptionShortName = "e";
             const std::string CoreSettings::ddLibraryOptionName = "ddlib";
+            const std::string CoreSettings::ddExplicitFallbackOptionName = "ddexplicitfallback";
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
@@ -49,6 +50,8 @@ namespace storm {
                 std::vector<std::string> ddLibraries = {"cudd", "sylvan"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, ddLibraryOptionName, false, "Sets which library is preferred for decision-diagram operations.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the library to prefer.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddLibraries)).setDefaultValueString("sylvan").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddExplicitFallbackOptionName, false, "Sets the number of nodes of the solution vector DD above which symbolic solvers switch to explicit solving.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("nodes", "The maximal number of nodes (0 disables the fallback).").setDefaultValueUnsignedInteger(1000000).build()).build());
                 
                 std::vector<std::string> lpSolvers = {"gurobi", "glpk", "z3"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, lpSolverOptionName, false, "Sets which LP solver is preferred.")
@@ -128,6 +131,10 @@ namespace storm {
                 return !this->getOption(ddLibraryOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(ddLibraryOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
             
+            uint64_t CoreSettings::getDdExplicitFallbackThreshold() const {
+                return this->getOption(ddExplicitFallbackOptionName).getArgumentByName("nodes").getValueAsUnsignedInteger();
+            }
+            
             bool CoreSettings::isShowStatisticsSet() const {
                 return this->getOption(statisticsOptionName).getHasOptionBeenSet();
             }
@@ -135,6 +142,10 @@ namespace storm {
             bool CoreSettings::isUseIntelTbbSet() const {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
+            
+            std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideUseIntelTbbSet(bool stateToSet) {
+                return this->overrideOption(intelTbbOptionName, stateToSet);
+            }
 
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
@@ -89,6 +89,14 @@ namespace storm {
                  */
                 bool isDdLibraryTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves the number of nodes of the solution vector DD above which symbolic equation solvers switch
+                 * to solving the remaining system explicitly.
+                 *
+                 * @return The threshold, where zero means that the fallback is disabled.
+                 */
+                uint64_t getDdExplicitFallbackThreshold() const;
+                
                 /*!
                  * Retrieves whether statistics are to be shown
                  *
@@ -102,6 +110,15 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseIntelTbbSet() const;
+                
+                /*!
+                 * Overrides the option to use Intel TBB by setting it to the specified value. As soon as the returned
+                 * memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideUseIntelTbbSet(bool stateToSet);
 
                 /*!
                  * Retrieves whether the option to use CUDA is set.
@@ -140,6 +157,7 @@ namespace storm {
                 static const std::string engineOptionName;
                 static const std::string engineOptionShortName;
                 static const std::string ddLibraryOptionName;
+                static const std::string ddExplicitFallbackOptionName;
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
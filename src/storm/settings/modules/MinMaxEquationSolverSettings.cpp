@@ -19,9 +19,11 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string MinMaxEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
+            const std::string MinMaxEquationSolverSettings::adaptiveConvergenceCheckOptionName = "adaptivecheck";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi", "acyclic"};
+                std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "pvi", "prioritized-value-iteration", "topological", "vi-to-pi", "acyclic"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which min/max linear equation solving technique is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a min/max linear equation solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(minMaxSolvingTechniques)).setDefaultValueString("topological").build()).build());
                 
@@ -37,6 +39,10 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "If set, value iteration first iterates on a single precision copy of the matrix and then refines the result in the original precision.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveConvergenceCheckOptionName, false, "If set, value iteration estimates the rate of convergence and only checks for convergence when it is expected to be close.").setIsAdvanced().build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -55,6 +61,8 @@ namespace storm {
                     return storm::solver::MinMaxMethod::SoundValueIteration;
                 } else if (minMaxEquationSolvingTechnique == "optimistic-value-iteration" || minMaxEquationSolvingTechnique == "ovi") {
                     return storm::solver::MinMaxMethod::OptimisticValueIteration;
+                } else if (minMaxEquationSolvingTechnique == "prioritized-value-iteration" || minMaxEquationSolvingTechnique == "pvi") {
+                    return storm::solver::MinMaxMethod::PrioritizedValueIteration;
                 } else if (minMaxEquationSolvingTechnique == "topological") {
                     return storm::solver::MinMaxMethod::Topological;
                 } else if (minMaxEquationSolvingTechnique == "vi-to-pi") {
@@ -112,6 +120,14 @@ namespace storm {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
             
+            bool MinMaxEquationSolverSettings::isMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MinMaxEquationSolverSettings::isAdaptiveConvergenceCheckSet() const {
+                return this->getOption(adaptiveConvergenceCheckOptionName).getHasOptionBeenSet();
+            }
+            
         }
     }
 }
@@ -95,6 +95,16 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether value iteration performs most of its iterations in a lower precision.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves whether value iteration checks convergence in adaptively chosen iterations only.
+                 */
+                bool isAdaptiveConvergenceCheckSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +116,8 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string mixedPrecisionOptionName;
+                static const std::string adaptiveConvergenceCheckOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
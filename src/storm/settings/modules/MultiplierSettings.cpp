@@ -13,12 +13,14 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::numaOptionName = "numa";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, numaOptionName, false, "If set, parallel multiplications of the native multiplier (see --enable-tbb) use a copy of the matrix that is distributed over the NUMA nodes of the threads, which are pinned to cores.").setIsAdvanced().build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
@@ -35,6 +37,10 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isNumaAwarePlacementSet() const {
+                return this->getOption(numaOptionName).getHasOptionBeenSet();
+            }
         }
     }
 }
@@ -22,11 +22,17 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether parallel multiplications distribute the matrix over the NUMA nodes of the threads.
+                 */
+                bool isNumaAwarePlacementSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string numaOptionName;
             };
             
         }
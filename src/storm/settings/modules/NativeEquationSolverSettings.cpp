@@ -18,15 +18,19 @@ namespace storm {
             const std::string NativeEquationSolverSettings::moduleName = "native";
             const std::string NativeEquationSolverSettings::techniqueOptionName = "method";
             const std::string NativeEquationSolverSettings::omegaOptionName = "soromega";
+            const std::string NativeEquationSolverSettings::preconditionOptionName = "precond";
+            const std::string NativeEquationSolverSettings::restartOptionName = "restart";
             const std::string NativeEquationSolverSettings::maximalIterationsOptionName = "maxiter";
             const std::string NativeEquationSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string NativeEquationSolverSettings::precisionOptionName = "precision";
             const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
             const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string NativeEquationSolverSettings::mixedPrecisionOptionName = "mixedprecision";
+            const std::string NativeEquationSolverSettings::adaptiveConvergenceCheckOptionName = "adaptivecheck";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "sound-value-iteration", "svi", "optimistic-value-itearation", "ovi", "interval-iteration", "ii", "ratsearch" };
+                std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "multicolor-gaussseidel", "mcgs", "multicolor-sor", "mcsor", "walkerchae", "power", "sound-value-iteration", "svi", "optimistic-value-itearation", "ovi", "interval-iteration", "ii", "ratsearch", "bicgstab", "gmres", "aggregation-disaggregation", "ad" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, techniqueOptionName, true, "The method to be used for solving linear equation systems with the native engine.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods)).setDefaultValueString("jacobi").build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalIterationsOptionName, false, "The maximal number of iterations to perform before iterative solving is aborted.").setIsAdvanced().setShortName(maximalIterationsOptionShortName).addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal iteration count.").build()).build());
@@ -35,6 +39,11 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, omegaOptionName, false, "The omega used for SOR.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value of the SOR parameter.").setDefaultValueDouble(0.9).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
+                std::vector<std::string> preconditioner = {"ilu", "diagonal", "none"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, preconditionOptionName, false, "The preconditioning technique used by the Krylov subspace methods (bicgstab, gmres).").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the preconditioning method.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(preconditioner)).setDefaultValueString("ilu").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, restartOptionName, false, "The number of iterations until GMRES is restarted.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of iterations.").setDefaultValueUnsignedInteger(50).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
                 
                 std::vector<std::string> multiplicationStyles = {"gaussseidel", "regular", "gs", "r"};
@@ -42,6 +51,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplication style.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplicationStyles)).setDefaultValueString("gaussseidel").build()).build());
                                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "If set, the power method first iterates on a single precision copy of the matrix and then refines the result in the original precision.").setIsAdvanced().build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveConvergenceCheckOptionName, false, "If set, the power method and the Jacobi method estimate the rate of convergence and only check for convergence when it is expected to be close.").setIsAdvanced().build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -60,6 +73,10 @@ namespace storm {
                     return storm::solver::NativeLinearEquationSolverMethod::GaussSeidel;
                 } else if (linearEquationSystemTechniqueAsString == "sor") {
                     return storm::solver::NativeLinearEquationSolverMethod::SOR;
+                } else if (linearEquationSystemTechniqueAsString == "multicolor-gaussseidel" || linearEquationSystemTechniqueAsString == "mcgs") {
+                    return storm::solver::NativeLinearEquationSolverMethod::MulticolorGaussSeidel;
+                } else if (linearEquationSystemTechniqueAsString == "multicolor-sor" || linearEquationSystemTechniqueAsString == "mcsor") {
+                    return storm::solver::NativeLinearEquationSolverMethod::MulticolorSOR;
                 } else if (linearEquationSystemTechniqueAsString == "walkerchae") {
                     return storm::solver::NativeLinearEquationSolverMethod::WalkerChae;
                 } else if (linearEquationSystemTechniqueAsString == "power") {
@@ -72,6 +89,12 @@ namespace storm {
                     return storm::solver::NativeLinearEquationSolverMethod::IntervalIteration;
                 } else if (linearEquationSystemTechniqueAsString == "ratsearch") {
                     return storm::solver::NativeLinearEquationSolverMethod::RationalSearch;
+                } else if (linearEquationSystemTechniqueAsString == "bicgstab") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Bicgstab;
+                } else if (linearEquationSystemTechniqueAsString == "gmres") {
+                    return storm::solver::NativeLinearEquationSolverMethod::Gmres;
+                } else if (linearEquationSystemTechniqueAsString == "aggregation-disaggregation" || linearEquationSystemTechniqueAsString == "ad") {
+                    return storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown solution technique '" << linearEquationSystemTechniqueAsString << "' selected.");
             }
@@ -96,6 +119,22 @@ namespace storm {
                 return this->getOption(omegaOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            storm::solver::NativeLinearEquationSolverPreconditioner NativeEquationSolverSettings::getPreconditioningMethod() const {
+                std::string preconditioningMethodAsString = this->getOption(preconditionOptionName).getArgumentByName("name").getValueAsString();
+                if (preconditioningMethodAsString == "ilu") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::Ilu;
+                } else if (preconditioningMethodAsString == "diagonal") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+                } else if (preconditioningMethodAsString == "none") {
+                    return storm::solver::NativeLinearEquationSolverPreconditioner::None;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown preconditioning technique '" << preconditioningMethodAsString << "' selected.");
+            }
+            
+            uint_fast64_t NativeEquationSolverSettings::getRestartIterationCount() const {
+                return this->getOption(restartOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             bool NativeEquationSolverSettings::isConvergenceCriterionSet() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet();
             }
@@ -117,6 +156,14 @@ namespace storm {
             bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet() const {
                 return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
             }
+            
+            bool NativeEquationSolverSettings::isMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+            
+            bool NativeEquationSolverSettings::isAdaptiveConvergenceCheckSet() const {
+                return this->getOption(adaptiveConvergenceCheckOptionName).getHasOptionBeenSet();
+            }
 
             bool NativeEquationSolverSettings::check() const {
                 return true;
@@ -79,6 +79,20 @@ namespace storm {
                  */
                 double getOmega() const;
                 
+                /*!
+                 * Retrieves the preconditioning method that is to be used by the Krylov subspace methods.
+                 *
+                 * @return The preconditioning method to use.
+                 */
+                storm::solver::NativeLinearEquationSolverPreconditioner getPreconditioningMethod() const;
+                
+                /*!
+                 * Retrieves the number of iterations after which restarted methods are to be restarted.
+                 *
+                 * @return The number of iterations after which to restart.
+                 */
+                uint_fast64_t getRestartIterationCount() const;
+                
                 /*!
                  * Retrieves whether the convergence criterion has been set.
                  *
@@ -98,6 +112,16 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves whether the power method performs most of its iterations in a lower precision.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves whether the power method and the Jacobi method checks convergence in adaptively chosen iterations only.
+                 */
+                bool isAdaptiveConvergenceCheckSet() const;
+                
                 /*!
                  * Retrieves the multiplication style to use in the power method.
                  *
@@ -119,11 +143,15 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string techniqueOptionName;
                 static const std::string omegaOptionName;
+                static const std::string preconditionOptionName;
+                static const std::string restartOptionName;
                 static const std::string maximalIterationsOptionName;
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string mixedPrecisionOptionName;
+                static const std::string adaptiveConvergenceCheckOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
                 static const std::string forceBoundsOptionName;
 
@@ -16,6 +16,7 @@ namespace storm {
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
             const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+            const std::string ResourceSettings::ddMemoryBudgetOptionName = "ddmembudget";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setIsAdvanced().setShortName(timeoutOptionShortName)
@@ -23,6 +24,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false, "Specifies how much time can pass until termination when receiving a termination signal.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "Seconds after which to exit the program.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddMemoryBudgetOptionName, false, "If given, symbolic computations switch to explicit solving or abort once the DD library uses more memory than the budget.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory budget in MB.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -40,6 +43,14 @@ namespace storm {
             uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
                 return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
             }
+            
+            bool ResourceSettings::isDdMemoryBudgetSet() const {
+                return this->getOption(ddMemoryBudgetOptionName).getHasOptionBeenSet();
+            }
+            
+            uint_fast64_t ResourceSettings::getDdMemoryBudgetInMegabytes() const {
+                return this->getOption(ddMemoryBudgetOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
 
         }
     }
@@ -47,6 +47,20 @@ namespace storm {
                  * @return The number of seconds after which to exit the program.
                  */
                 uint_fast64_t getSignalWaitingTimeInSeconds() const;
+                
+                /*!
+                 * Retrieves whether a memory budget for the DD library was set.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdMemoryBudgetSet() const;
+                
+                /*!
+                 * Retrieves the memory budget for the DD library in case the option was set.
+                 *
+                 * @return The memory budget in MB.
+                 */
+                uint_fast64_t getDdMemoryBudgetInMegabytes() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -58,6 +72,7 @@ namespace storm {
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
                 static const std::string signalWaitingTimeOptionName;
+                static const std::string ddMemoryBudgetOptionName;
             };
         }
     }
@@ -1,5 +1,7 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/adapters/EigenAdapter.h"
 
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -12,24 +14,42 @@ namespace storm {
     namespace solver {
 
         template<typename ValueType>
-        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver() {
+        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver() : sparseLuSolverFactorized(false) {
             // Intentionally left empty.
         }
 
         template<typename ValueType>
-        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) {
+        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : sparseLuSolverFactorized(false) {
             this->setMatrix(A);
         }
 
         template<typename ValueType>
-        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) {
+        EigenLinearEquationSolver<ValueType>::EigenLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : sparseLuSolverFactorized(false) {
             this->setMatrix(std::move(A));
         }
         
+        template<typename ValueType>
+        bool hasSameSparsityPattern(Eigen::SparseMatrix<ValueType> const& first, Eigen::SparseMatrix<ValueType> const& second) {
+            if (first.rows() != second.rows() || first.cols() != second.cols() || first.nonZeros() != second.nonZeros() || !first.isCompressed() || !second.isCompressed()) {
+                return false;
+            }
+            return std::equal(first.outerIndexPtr(), first.outerIndexPtr() + first.outerSize() + 1, second.outerIndexPtr()) && std::equal(first.innerIndexPtr(), first.innerIndexPtr() + first.nonZeros(), second.innerIndexPtr());
+        }
+        
         template<typename ValueType>
         void EigenLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
-            eigenA = storm::adapters::EigenAdapter::toEigenSparseMatrix<ValueType>(A);
-            this->clearCache();
+            std::unique_ptr<Eigen::SparseMatrix<ValueType>> newEigenA = storm::adapters::EigenAdapter::toEigenSparseMatrix<ValueType>(A);
+            
+            // If the sparsity pattern did not change (which is typically the case for the matrices of subsequent
+            // policies in policy iteration), the symbolic analysis of the LU solver can be reused.
+            bool keepSymbolicAnalysis = sparseLuSolver && eigenA && hasSameSparsityPattern(*eigenA, *newEigenA);
+            eigenA = std::move(newEigenA);
+            if (keepSymbolicAnalysis) {
+                sparseLuSolverFactorized = false;
+                LinearEquationSolver<ValueType>::clearCache();
+            } else {
+                this->clearCache();
+            }
         }
         
         template<typename ValueType>
@@ -37,7 +57,22 @@ namespace storm {
             // Take ownership of the matrix so it is destroyed after we have translated it to Eigen's format.
             storm::storage::SparseMatrix<ValueType> localA(std::move(A));
             this->setMatrix(localA);
-            this->clearCache();
+        }
+        
+        template<typename ValueType>
+        Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>& EigenLinearEquationSolver<ValueType>::getSparseLuSolver() const {
+            if (!sparseLuSolver) {
+                sparseLuSolver = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>>();
+                sparseLuSolver->analyzePattern(*eigenA);
+                sparseLuSolverFactorized = false;
+            } else {
+                STORM_LOG_TRACE("Reusing the symbolic analysis of the sparse LU factorization.");
+            }
+            if (!sparseLuSolverFactorized) {
+                sparseLuSolver->factorize(*eigenA);
+                sparseLuSolverFactorized = true;
+            }
+            return *sparseLuSolver;
         }
         
         template<typename ValueType>
@@ -75,11 +110,14 @@ namespace storm {
             auto eigenX = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(x.data(), x.size());
             auto eigenB = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(b.data(), b.size());
             
-            Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalNumber>, Eigen::COLAMDOrdering<int>> solver;
-            solver.compute(*eigenA);
+            auto& solver = getSparseLuSolver();
             solver._solve_impl(eigenB, eigenX);
+            bool success = solver.info() == Eigen::ComputationInfo::Success;
             
-            return solver.info() == Eigen::ComputationInfo::Success;
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return success;
         }
         
         // Specialization for storm::RationalFunction
@@ -93,10 +131,14 @@ namespace storm {
             auto eigenX = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(x.data(), x.size());
             auto eigenB = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(b.data(), b.size());
             
-            Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalFunction>, Eigen::COLAMDOrdering<int>> solver;
-            solver.compute(*eigenA);
+            auto& solver = getSparseLuSolver();
             solver._solve_impl(eigenB, eigenX);
-            return solver.info() == Eigen::ComputationInfo::Success;
+            bool success = solver.info() == Eigen::ComputationInfo::Success;
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return success;
         }
 #endif
 
@@ -110,9 +152,11 @@ namespace storm {
             auto solutionMethod = getMethod(env, env.solver().isForceExact());
             if (solutionMethod == EigenLinearEquationSolverMethod::SparseLU) {
                 STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with sparse LU factorization (Eigen library).");
-                Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
-                solver.compute(*this->eigenA);
-                solver._solve_impl(eigenB, eigenX);
+                getSparseLuSolver()._solve_impl(eigenB, eigenX);
+                
+                if (!this->isCachingEnabled()) {
+                    clearCache();
+                }
             } else {
                 bool converged = false;
                 uint64_t numberOfIterations = 0;
@@ -248,6 +292,13 @@ namespace storm {
             return LinearEquationSolverProblemFormat::EquationSystem;
         }
         
+        template<typename ValueType>
+        void EigenLinearEquationSolver<ValueType>::clearCache() const {
+            sparseLuSolver.reset();
+            sparseLuSolverFactorized = false;
+            LinearEquationSolver<ValueType>::clearCache();
+        }
+        
         template<typename ValueType>
         uint64_t EigenLinearEquationSolver<ValueType>::getMatrixRowCount() const {
             return eigenA->rows();
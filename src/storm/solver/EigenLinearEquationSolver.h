@@ -22,6 +22,8 @@ namespace storm {
             
             virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
+            virtual void clearCache() const override;
+
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
@@ -31,9 +33,20 @@ namespace storm {
             virtual uint64_t getMatrixRowCount() const override;
             virtual uint64_t getMatrixColumnCount() const override;
             
+            /*!
+             * Retrieves a sparse LU solver whose factorization corresponds to the current matrix. The symbolic
+             * analysis (fill-reducing ordering) and the numerical factorization are computed only if needed.
+             */
+            Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>& getSparseLuSolver() const;
+            
             // The (eigen) matrix associated with this equation solver.
             std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
 
+            // The sparse LU solver for the matrix (if SparseLU was used). The symbolic analysis is kept when a matrix
+            // with the same sparsity pattern is set, while the factorization is kept as long as the matrix is unchanged.
+            mutable std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>> sparseLuSolver;
+            mutable bool sparseLuSolverFactorized;
+
         };
         
         template<typename ValueType>
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <functional>
 #include <limits>
 
@@ -6,6 +7,10 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
+#include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+
+#include "storm/solver/helper/ConvergenceCheckScheduler.h"
+
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -55,7 +60,7 @@ namespace storm {
                     STORM_LOG_WARN("The selected solution method does not guarantee sound results.");
                 }
             }
-            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
+            STORM_LOG_THROW(method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PolicyIteration || method == MinMaxMethod::RationalSearch || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::OptimisticValueIteration || method == MinMaxMethod::ViToPi || method == MinMaxMethod::PrioritizedValueIteration, storm::exceptions::InvalidEnvironmentException, "This solver does not support the selected method.");
             return method;
         }
         
@@ -84,6 +89,9 @@ namespace storm {
                 case MinMaxMethod::ViToPi:
                     result = solveEquationsViToPi(env, dir, x, b);
                     break;
+                case MinMaxMethod::PrioritizedValueIteration:
+                    result = solveEquationsPrioritizedValueIteration(env, dir, x, b);
+                    break;
                 default:
                     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "This solver does not implement the selected solution method");
             }
@@ -96,27 +104,92 @@ namespace storm {
             assert(subB.size() == x.size());
             
             // Resolve the nondeterminism according to the given scheduler.
+            // If a matrix induced by a previous scheduler is available, we only patch the rows whose choice changed.
             bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> submatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
-            if (convertToEquationSystem) {
-                submatrix.convertToEquationSystem();
+            bool inducedMatrixChanged = !inducedMatrix || inducedMatrixIsEquationSystem != convertToEquationSystem || scheduler != inducedMatrixScheduler;
+            if (inducedMatrixChanged && (!inducedMatrix || inducedMatrixIsEquationSystem != convertToEquationSystem || !updateInducedMatrix(scheduler, convertToEquationSystem))) {
+                inducedMatrix = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem));
+                if (convertToEquationSystem) {
+                    inducedMatrix->convertToEquationSystem();
+                }
+                inducedMatrixIsEquationSystem = convertToEquationSystem;
             }
+            inducedMatrixScheduler = scheduler;
             storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
             
-            // Check whether the linear equation solver is already initialized
+            // The induced matrix is owned by this solver and is only passed by reference, so the linear equation solver
+            // does not copy it. As the matrix is patched in place, the solver has to be notified about every change.
             if (!linearEquationSolver) {
                 // Initialize the equation solver
-                linearEquationSolver = this->linearEquationSolverFactory->create(env, std::move(submatrix));
+                linearEquationSolver = this->linearEquationSolverFactory->create(env, *inducedMatrix);
                 linearEquationSolver->setBoundsFromOtherSolver(*this);
                 linearEquationSolver->setCachingEnabled(true);
-            } else {
-                // If the equation solver is already initialized, it suffices to update the matrix
-                linearEquationSolver->setMatrix(std::move(submatrix));
+            } else if (inducedMatrixChanged) {
+                linearEquationSolver->setMatrix(*inducedMatrix);
             }
             // Solve the equation system for the 'DTMC' and return true upon success
             return linearEquationSolver->solveEquations(env, x, subB);
         }
         
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::updateInducedMatrix(std::vector<uint64_t> const& scheduler, bool convertToEquationSystem) const {
+            STORM_LOG_ASSERT(inducedMatrixScheduler.size() == scheduler.size(), "Scheduler size mismatch.");
+            ValueType const one = storm::utility::one<ValueType>();
+            
+            uint64_t numberOfChangedRows = 0;
+            for (uint64_t group = 0; group < scheduler.size(); ++group) {
+                if (scheduler[group] == inducedMatrixScheduler[group]) {
+                    continue;
+                }
+                
+                // The new row has to have the same number of entries as the old one (taking into account the diagonal
+                // entry that is inserted when converting to an equation system).
+                auto sourceRow = this->A->getRow(this->A->getRowGroupIndices()[group] + scheduler[group]);
+                auto targetRow = inducedMatrix->getRow(group);
+                uint64_t numberOfEntries = sourceRow.getNumberOfEntries();
+                bool hasDiagonalEntry = std::find_if(sourceRow.begin(), sourceRow.end(), [&group] (storm::storage::MatrixEntry<uint64_t, ValueType> const& entry) { return entry.getColumn() == group; }) != sourceRow.end();
+                if (convertToEquationSystem && !hasDiagonalEntry) {
+                    ++numberOfEntries;
+                }
+                if (numberOfEntries != targetRow.getNumberOfEntries()) {
+                    STORM_LOG_TRACE("Rebuilding the induced matrix as the number of entries in row " << group << " changed.");
+                    return false;
+                }
+                
+                // Overwrite the row (applying the same transformation as converting the matrix to an equation system).
+                auto targetIt = targetRow.begin();
+                bool insertedDiagonalEntry = !convertToEquationSystem || hasDiagonalEntry;
+                for (auto const& entry : sourceRow) {
+                    if (!insertedDiagonalEntry && entry.getColumn() > group) {
+                        targetIt->setColumn(group);
+                        targetIt->setValue(one);
+                        ++targetIt;
+                        insertedDiagonalEntry = true;
+                    }
+                    targetIt->setColumn(entry.getColumn());
+                    if (!convertToEquationSystem) {
+                        targetIt->setValue(entry.getValue());
+                    } else if (entry.getColumn() == group) {
+                        targetIt->setValue(one - entry.getValue());
+                    } else {
+                        targetIt->setValue(-entry.getValue());
+                    }
+                    ++targetIt;
+                }
+                if (!insertedDiagonalEntry) {
+                    targetIt->setColumn(group);
+                    targetIt->setValue(one);
+                }
+                ++numberOfChangedRows;
+            }
+            
+            if (numberOfChangedRows > 0) {
+                inducedMatrix->updateNonzeroEntryCount();
+            }
+            STORM_LOG_TRACE("Updated " << numberOfChangedRows << " rows of the induced matrix in place.");
+            return true;
+        }
+        
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
@@ -238,7 +311,7 @@ namespace storm {
             needsLinEqSolver |= method == MinMaxMethod::ViToPi;
             MinMaxLinearEquationSolverRequirements requirements = needsLinEqSolver ? MinMaxLinearEquationSolverRequirements(this->linearEquationSolverFactory->getRequirements(env)) : MinMaxLinearEquationSolverRequirements();
 
-            if (method == MinMaxMethod::ValueIteration) {
+            if (method == MinMaxMethod::ValueIteration || method == MinMaxMethod::PrioritizedValueIteration) {
                 if (!this->hasUniqueSolution()) { // Traditional value iteration has no requirements if the solution is unique.
                     // Computing a scheduler is only possible if the solution is unique
                     if (this->isTrackSchedulerSet()) {
@@ -307,25 +380,36 @@ namespace storm {
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
             uint64_t iterations = currentIterations;
+            storm::solver::helper::ConvergenceCheckScheduler<ValueType> checkScheduler(precision, env.solver().minMax().isAdaptiveConvergenceCheckSet());
             
             SolverStatus status = SolverStatus::InProgress;
             while (status == SolverStatus::InProgress) {
-                // Compute x' = min/max(A*x + b).
-                if (useGaussSeidelMultiplication) {
-                    // Copy over the current vector so we can modify it in-place.
-                    *newX = *currentX;
-                    multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+                // Compute x' = min/max(A*x + b). The difference to the previous iterate is only computed if convergence is checked.
+                if (checkScheduler.isCheckDue(iterations)) {
+                    ValueType difference;
+                    if (useGaussSeidelMultiplication) {
+                        // Copy over the current vector so we can modify it in-place.
+                        *newX = *currentX;
+                        multiplier.multiplyAndReduceGaussSeidel(env, dir, *newX, &b);
+                        difference = storm::utility::vector::maximalDifferenceModuloPrecision(*currentX, *newX, relative);
+                    } else {
+                        difference = multiplier.multiplyAndReduceAndComputeDifference(env, dir, *currentX, &b, *newX, relative);
+                    }
+                    checkScheduler.reportDifference(iterations, difference);
+                    
+                    // Determine whether the method converged.
+                    if (difference <= precision) {
+                        status = SolverStatus::Converged;
+                    }
+                    std::swap(currentX, newX);
+                } else if (useGaussSeidelMultiplication) {
+                    multiplier.multiplyAndReduceGaussSeidel(env, dir, *currentX, &b);
                 } else {
                     multiplier.multiplyAndReduce(env, dir, *currentX, &b, *newX);
-                }
-                
-                // Determine whether the method converged.
-                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
-                    status = SolverStatus::Converged;
+                    std::swap(currentX, newX);
                 }
                 
                 // Update environment variables.
-                std::swap(currentX, newX);
                 ++iterations;
                 status = this->updateStatus(status, *currentX, guarantee, iterations, maximalNumberOfIterations);
 
@@ -471,14 +555,170 @@ namespace storm {
             std::vector<ValueType>* currentX = &x;
             
             this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            uint64_t impreciseIterations = 0;
+            if (env.solver().minMax().isMixedPrecisionSet()) {
+                // Values obtained in lower precision might violate the guarantee of the initial values.
+                if (guarantee == SolverGuarantee::None) {
+                    if (!mixedPrecisionHelper) {
+                        mixedPrecisionHelper = std::make_unique<storm::solver::helper::MixedPrecisionHelper<ValueType>>(*this->A);
+                    }
+                    impreciseIterations = mixedPrecisionHelper->performIterations(dir, x, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel);
+                } else {
+                    STORM_LOG_WARN("Not performing iterations in lower precision as value iteration needs to approach the solution from one side.");
+                }
+            }
+            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), guarantee, impreciseIterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
                 std::swap(x, *currentX);
             }
             
-            this->reportStatus(result.status, result.iterations);
+            this->reportStatus(result.status, impreciseIterations + result.iterations);
+            
+            // If requested, we store the scheduler for retrieval.
+            if (this->isTrackSchedulerSet()) {
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        class PrioritizedValueIterationPriorityLess {
+        public:
+            PrioritizedValueIterationPriorityLess(std::vector<ValueType> const& residuals) : residuals(residuals) {
+                // Intentionally left empty.
+            }
+            
+            bool operator()(uint64_t const& a, uint64_t const& b) const {
+                return residuals[a] < residuals[b];
+            }
+            
+        private:
+            std::vector<ValueType> const& residuals;
+        };
+        
+        template<typename ValueType>
+        uint64_t IterativeMinMaxLinearEquationSolver<ValueType>::performPrioritizedSweeping(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maximalNumberOfUpdates) const {
+            if (!backwardTransitions) {
+                backwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->A->transpose(true));
+            }
+            
+            // Compute the initial residuals.
+            uint64_t numberOfRowGroups = this->A->getRowGroupCount();
+            if (!auxiliaryRowGroupVector2) {
+                auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(numberOfRowGroups);
+            }
+            std::vector<ValueType>& residuals = *auxiliaryRowGroupVector2;
+            this->multiplierA->multiplyAndReduce(env, dir, x, &b, residuals);
+            for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+                residuals[group] = storm::utility::abs<ValueType>(residuals[group] - x[group]);
+            }
+            
+            // As the Bellman operator is non-expansive, updating a row group changes the residual of a predecessor by
+            // at most the (maximal) probability to move to the updated row group times the change of its value. We thus
+            // maintain upper bounds on the residuals which only need to increase between two updates of a row group.
+            storm::storage::ConsecutiveUint64DynamicPriorityQueue<PrioritizedValueIterationPriorityLess<ValueType>> queue(numberOfRowGroups, PrioritizedValueIterationPriorityLess<ValueType>(residuals));
+            uint64_t updates = 0;
+            while (!queue.empty() && updates < maximalNumberOfUpdates) {
+                uint64_t group = queue.popTop();
+                ValueType residual = std::move(residuals[group]);
+                residuals[group] = storm::utility::zero<ValueType>();
+                if (relative ? residual <= precision * storm::utility::abs<ValueType>(x[group]) : residual <= precision) {
+                    continue;
+                }
+                
+                ValueType oldValue = x[group];
+                computeOptimalValueForRowGroup(group, dir, x, b);
+                ++updates;
+                ValueType change = storm::utility::abs<ValueType>(x[group] - oldValue);
+                if (!storm::utility::isZero(change)) {
+                    for (auto const& entry : backwardTransitions->getRow(group)) {
+                        uint64_t predecessor = entry.getColumn();
+                        residuals[predecessor] += storm::utility::abs<ValueType>(entry.getValue()) * change;
+                        if (queue.contains(predecessor)) {
+                            queue.increase(predecessor);
+                        } else {
+                            queue.push(predecessor);
+                        }
+                    }
+                }
+                
+                if (updates % numberOfRowGroups == 0) {
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                    this->showProgressIterative(updates / numberOfRowGroups);
+                }
+            }
+            STORM_LOG_INFO("Prioritized sweeping performed " << updates << " updates of " << numberOfRowGroups << " row groups.");
+            return updates;
+        }
+        
+        /*!
+         * This version of value iteration updates the row groups in the order of their residuals (prioritized sweeping)
+         * and thereby avoids updating row groups whose values already converged. As the residuals only serve as
+         * priorities, we conclude with regular value iteration that performs the usual convergence check.
+         */
+        template<typename ValueType>
+        bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->multiplierA) {
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+            }
+            
+            if (!auxiliaryRowGroupVector) {
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+            }
+            
+            // Initialize the values as in regular value iteration. Note that updating single row groups preserves that
+            // the values are below (above) the solution.
+            SolverGuarantee guarantee = SolverGuarantee::None;
+            if (!this->hasUniqueSolution()) {
+                if (maximize(dir)) {
+                    this->createLowerBoundsVector(x);
+                    guarantee = SolverGuarantee::LessOrEqual;
+                } else {
+                    this->createUpperBoundsVector(x);
+                    guarantee = SolverGuarantee::GreaterOrEqual;
+                }
+            } else if (this->hasCustomTerminationCondition()) {
+                if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::LessOrEqual) && this->hasLowerBound()) {
+                    this->createLowerBoundsVector(x);
+                    guarantee = SolverGuarantee::LessOrEqual;
+                } else if (this->getTerminationCondition().requiresGuarantee(SolverGuarantee::GreaterOrEqual) && this->hasUpperBound()) {
+                    this->createUpperBoundsVector(x);
+                    guarantee = SolverGuarantee::GreaterOrEqual;
+                }
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+            bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+            uint64_t maximalNumberOfIterations = env.solver().minMax().getMaximalNumberOfIterations();
+            uint64_t numberOfRowGroups = std::max<uint64_t>(this->A->getRowGroupCount(), 1);
+            uint64_t maximalNumberOfUpdates = maximalNumberOfIterations > std::numeric_limits<uint64_t>::max() / numberOfRowGroups ? std::numeric_limits<uint64_t>::max() : maximalNumberOfIterations * numberOfRowGroups;
+            
+            this->startMeasureProgress();
+            uint64_t updates = performPrioritizedSweeping(env, dir, x, b, precision, relative, maximalNumberOfUpdates);
+            
+            // Count the updates in terms of (rounded up) full sweeps.
+            uint64_t sweepIterations = (updates + numberOfRowGroups - 1) / numberOfRowGroups;
+            std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
+            std::vector<ValueType>* currentX = &x;
+            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, precision, relative, guarantee, sweepIterations, maximalNumberOfIterations, env.solver().minMax().getMultiplicationStyle());
+            
+            // Swap the result into the output x.
+            if (currentX == auxiliaryRowGroupVector.get()) {
+                std::swap(x, *currentX);
+            }
+            
+            this->reportStatus(result.status, sweepIterations + result.iterations);
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
@@ -525,9 +765,11 @@ namespace storm {
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
             std::vector<ValueType>* tmp = nullptr;
+            std::vector<ValueType> tmp2;
             if (!useGaussSeidelMultiplication) {
                 auxiliaryRowGroupVector2 = std::make_unique<std::vector<ValueType>>(lowerX->size());
                 tmp = auxiliaryRowGroupVector2.get();
+                tmp2.resize(lowerX->size());
             }
             
             // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
@@ -571,16 +813,15 @@ namespace storm {
                             maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                         }
                     } else {
-                        this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                        // Update both bounds in a single pass over the matrix. The new upper values are swapped into
+                        // the buffer of the upper bound so that only the three buffers above are shuffled around.
+                        this->multiplierA->multiplyAndReduce2(env, dir, *lowerX, *upperX, &b, *tmp, tmp2);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, tmp2, this->getRelevantValues());
                         }
                         std::swap(lowerX, tmp);
-                        this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
-                        std::swap(upperX, tmp);
+                        std::swap(*upperX, tmp2);
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
@@ -686,9 +927,9 @@ namespace storm {
                 this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular);
             } else {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular);
             }
             
             // Prepare initial bounds for the solution (if given)
@@ -1073,6 +1314,10 @@ namespace storm {
             auxiliaryRowGroupVector2.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
+            mixedPrecisionHelper.reset();
+            backwardTransitions.reset();
+            inducedMatrix.reset();
+            inducedMatrixScheduler.clear();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
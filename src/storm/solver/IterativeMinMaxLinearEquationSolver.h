@@ -9,6 +9,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
 
 #include "storm/solver/SolverStatus.h"
 
@@ -36,6 +37,15 @@ namespace storm {
             MinMaxMethod getMethod(Environment const& env, bool isExactMode) const;
             
             bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
+
+            /*!
+             * Updates the cached induced matrix such that it corresponds to the given scheduler. Only the rows of
+             * row groups whose choice changed are overwritten in place.
+             *
+             * @return False iff the matrix could not be updated in place (because the number of entries of some
+             * changed row differs), in which case the induced matrix needs to be rebuilt.
+             */
+            bool updateInducedMatrix(std::vector<uint64_t> const& scheduler, bool convertToEquationSystem) const;
             bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
             bool valueImproved(OptimizationDirection dir, ValueType const& value1, ValueType const& value2) const;
@@ -45,6 +55,7 @@ namespace storm {
             bool solveEquationsIntervalIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             bool solveEquationsViToPi(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            bool solveEquationsPrioritizedValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             bool solveEquationsRationalSearch(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             
@@ -74,6 +85,16 @@ namespace storm {
             template <typename ValueTypePrime>
             friend class IterativeMinMaxLinearEquationSolver;
             
+            /*!
+             * Performs asynchronous updates of single row groups in the order of (upper bounds on) their residuals,
+             * i.e. the difference between the current value and the value obtained by a Bellman update. After updating
+             * a row group, the residuals of its predecessors are increased accordingly. Stops as soon as all residuals
+             * are below the precision or the given number of updates has been performed.
+             *
+             * @return The number of performed updates.
+             */
+            uint64_t performPrioritizedSweeping(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maximalNumberOfUpdates) const;
+            
             ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t  maximalNumberOfIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
             void createLinearEquationSolver(Environment const& env) const;
@@ -87,6 +108,15 @@ namespace storm {
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector2; // A.rowGroupCount() entries
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::MixedPrecisionHelper<ValueType>> mixedPrecisionHelper;
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> backwardTransitions; // A transposed with joined row groups
+            
+            // The matrix of the equation system induced by the scheduler of the most recent policy evaluation (together
+            // with that scheduler and whether the matrix was converted to an equation system). Subsequent policy
+            // evaluations only patch the rows whose choice changed.
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> inducedMatrix;
+            mutable std::vector<uint64_t> inducedMatrixScheduler;
+            mutable bool inducedMatrixIsEquationSystem;
             
         };
         
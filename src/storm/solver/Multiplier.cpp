@@ -13,8 +13,10 @@
 #include "storm/solver/GmmxxMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/vector.h"
 
 namespace storm {
     namespace solver {
@@ -39,6 +41,54 @@ namespace storm {
             multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
         }
     
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multiply(env, x1, b, result1);
+            multiply(env, x2, b, result2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multiplyAndReduce2(env, dir, this->matrix.getRowGroupIndices(), x1, x2, b, result1, result2);
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multiplyAndReduce(env, dir, rowGroupIndices, x1, b, result1);
+            multiplyAndReduce(env, dir, rowGroupIndices, x2, b, result2);
+        }
+        
+        template<typename ValueType>
+        ValueType Multiplier<ValueType>::multiplyAndComputeDifference(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const {
+            STORM_LOG_ASSERT(&x != &result, "The difference can not be computed for in-place multiplications.");
+            multiply(env, x, b, result);
+            return storm::utility::vector::maximalDifferenceModuloPrecision(x, result, relative);
+        }
+        
+        template<typename ValueType>
+        ValueType Multiplier<ValueType>::multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const {
+            return multiplyAndReduceAndComputeDifference(env, dir, this->matrix.getRowGroupIndices(), x, b, result, relative);
+        }
+        
+        template<typename ValueType>
+        ValueType Multiplier<ValueType>::multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const {
+            STORM_LOG_ASSERT(&x != &result, "The difference can not be computed for in-place multiplications.");
+            multiplyAndReduce(env, dir, rowGroupIndices, x, b, result);
+            return storm::utility::vector::maximalDifferenceModuloPrecision(x, result, relative);
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        storm::RationalFunction Multiplier<storm::RationalFunction>::multiplyAndComputeDifference(Environment const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, bool) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        storm::RationalFunction Multiplier<storm::RationalFunction>::multiplyAndReduceAndComputeDifference(Environment const&, OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, bool) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void Multiplier<ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
             storm::utility::ProgressMeasurement progress("multiplications");
@@ -88,6 +88,65 @@ namespace storm {
             void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const = 0;
             
+            /*!
+             * Performs the two matrix-vector multiplications x1' = A*x1 + b and x2' = A*x2 + b. Implementations may
+             * perform both multiplications in a single pass over the matrix.
+             *
+             * @param x1 The first input vector.
+             * @param x2 The second input vector.
+             * @param b If non-null, this vector is added after the multiplications.
+             * @param result1 The target vector for the first multiplication. Must not be the same as x1 or x2.
+             * @param result2 The target vector for the second multiplication. Must not be the same as x1 or x2.
+             */
+            virtual void multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const;
+            
+            /*!
+             * Performs the two matrix-vector multiplications x1' = A*x1 + b and x2' = A*x2 + b, each followed by a
+             * minimization/maximization over the row groups. Implementations may perform both multiplications in a
+             * single pass over the matrix.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x1 The first input vector.
+             * @param x2 The second input vector.
+             * @param b If non-null, this vector is added after the multiplications.
+             * @param result1 The target vector for the first multiplication. Must not be the same as x1 or x2.
+             * @param result2 The target vector for the second multiplication. Must not be the same as x1 or x2.
+             */
+            void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const;
+            
+            /*!
+             * Performs a matrix-vector multiplication x' = A*x + b and computes the largest difference between the entries
+             * of x and x' (see storm::utility::vector::maximalDifferenceModuloPrecision), so that the vectors are equal
+             * modulo a precision iff the returned difference does not exceed it. Implementations may compute the
+             * difference in the same pass over the matrix. The matrix has to be square.
+             *
+             * @param x The input vector with which to multiply the matrix.
+             * @param b If non-null, this vector is added after the multiplication.
+             * @param result The target vector into which to write the multiplication result. Must not be the same as x.
+             * @param relative If set, the difference is computed relative to the entries of x.
+             * @return The largest difference between the entries of x and x'.
+             */
+            virtual ValueType multiplyAndComputeDifference(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const;
+            
+            /*!
+             * Performs a matrix-vector multiplication x' = A*x + b followed by a minimization/maximization over the row
+             * groups and computes the largest difference between the entries of x and x' (see
+             * storm::utility::vector::maximalDifferenceModuloPrecision). Implementations may compute the difference in
+             * the same pass over the matrix. The number of row groups has to match the number of columns.
+             *
+             * @param dir The direction for the reduction step.
+             * @param rowGroupIndices A vector storing the row groups over which to reduce.
+             * @param x The input vector with which to multiply the matrix.
+             * @param b If non-null, this vector is added after the multiplication.
+             * @param result The target vector into which to write the multiplication result. Must not be the same as x.
+             * @param relative If set, the difference is computed relative to the entries of x.
+             * @return The largest difference between the entries of x and x'.
+             */
+            ValueType multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const;
+            virtual ValueType multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const;
+            
             /*!
              * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
              * performing the necessary multiplications, the result is written to the input vector x. Note that the
@@ -11,6 +11,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/ConvergenceCheckScheduler.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -52,13 +53,19 @@ namespace storm {
         }
 
         template<typename ValueType>
-        bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const {
-            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega, bool multicolor) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (" << (multicolor ? "multicolor " : "") << "Gauss-Seidel, SOR omega = " << omega << ")");
 
             if (!this->cachedRowVector) {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
             
+            // Rows of the same colour do not depend on each other, so they can be updated in parallel.
+            if (multicolor && !this->rowColoring) {
+                this->rowColoring = std::make_unique<std::vector<std::vector<uint_fast64_t>>>(A->computeRowGroupColoring());
+                STORM_LOG_INFO("Partitioned the " << getMatrixRowCount() << " rows into " << this->rowColoring->size() << " colour classes.");
+            }
+            
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
             uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             bool relative = env.solver().native().getRelativeTerminationCriterion();
@@ -69,7 +76,11 @@ namespace storm {
             
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
-                A->performSuccessiveOverRelaxationStep(omega, x, b);
+                if (multicolor) {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b, *this->rowColoring);
+                } else {
+                    A->performSuccessiveOverRelaxationStep(omega, x, b);
+                }
                 
                 // Now check if the process already converged within our precision.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
@@ -129,17 +140,30 @@ namespace storm {
             // Set up additional environment variables.
             uint_fast64_t iterations = 0;
             SolverStatus status = SolverStatus::InProgress;
+            storm::solver::helper::ConvergenceCheckScheduler<ValueType> checkScheduler(precision, env.solver().native().isAdaptiveConvergenceCheckSet());
 
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
-                // Compute D^-1 * (b - LU * x) and store result in nextX.
+                // Compute D^-1 * (b - LU * x) and store result in nextX. The difference to the previous iterate is
+                // computed in the same pass if convergence is checked in this iteration.
                 jacobiDecomposition->multiplier->multiply(env, *currentX, nullptr, *nextX);
-                storm::utility::vector::subtractVectors(b, *nextX, *nextX);
-                storm::utility::vector::multiplyVectorsPointwise(jacobiDecomposition->DVector, *nextX, *nextX);
-                
-                // Now check if the process already converged within our precision.
-                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *nextX, precision, relative)) {
-                    status = SolverStatus::Converged;
+                std::vector<ValueType> const& diagonal = jacobiDecomposition->DVector;
+                if (checkScheduler.isCheckDue(iterations)) {
+                    ValueType difference = storm::utility::zero<ValueType>();
+                    for (uint64_t row = 0; row < nextX->size(); ++row) {
+                        (*nextX)[row] = diagonal[row] * (b[row] - (*nextX)[row]);
+                        difference = std::max(difference, storm::utility::vector::differenceModuloPrecision((*currentX)[row], (*nextX)[row], relative));
+                    }
+                    checkScheduler.reportDifference(iterations, difference);
+                    
+                    // Now check if the process already converged within our precision.
+                    if (difference <= precision) {
+                        status = SolverStatus::Converged;
+                    }
+                } else {
+                    for (uint64_t row = 0; row < nextX->size(); ++row) {
+                        (*nextX)[row] = diagonal[row] * (b[row] - (*nextX)[row]);
+                    }
                 }
                 // Swap the two pointers as a preparation for the next iteration.
                 std::swap(nextX, currentX);
@@ -315,22 +339,34 @@ namespace storm {
             bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
             
             uint64_t iterations = currentIterations;
+            storm::solver::helper::ConvergenceCheckScheduler<ValueType> checkScheduler(precision, env.solver().native().isAdaptiveConvergenceCheckSet());
             SolverStatus status = this->terminateNow(*currentX, guarantee) ? SolverStatus::TerminatedEarly : SolverStatus::InProgress;
             while (status == SolverStatus::InProgress && iterations < maxIterations) {
-                if (useGaussSeidelMultiplication) {
-                    *newX = *currentX;
-                    this->multiplier->multiplyGaussSeidel(env, *newX, &b);
+                // The difference to the previous iterate is only computed if convergence is checked.
+                if (checkScheduler.isCheckDue(iterations)) {
+                    ValueType difference;
+                    if (useGaussSeidelMultiplication) {
+                        *newX = *currentX;
+                        this->multiplier->multiplyGaussSeidel(env, *newX, &b);
+                        difference = storm::utility::vector::maximalDifferenceModuloPrecision(*currentX, *newX, relative);
+                    } else {
+                        difference = this->multiplier->multiplyAndComputeDifference(env, *currentX, &b, *newX, relative);
+                    }
+                    checkScheduler.reportDifference(iterations, difference);
+                    
+                    // Check for convergence.
+                    if (difference <= precision) {
+                        status = SolverStatus::Converged;
+                    }
+                    std::swap(currentX, newX);
+                } else if (useGaussSeidelMultiplication) {
+                    this->multiplier->multiplyGaussSeidel(env, *currentX, &b);
                 } else {
                     this->multiplier->multiply(env, *currentX, &b, *newX);
-                }
-                
-                // Check for convergence.
-                if (storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative)) {
-                    status = SolverStatus::Converged;
+                    std::swap(currentX, newX);
                 }
 
                 // Check for termination.
-                std::swap(currentX, newX);
                 ++iterations;
 
                 status = this->updateStatus(status, *currentX, guarantee, iterations, maxIterations);
@@ -369,7 +405,8 @@ namespace storm {
             // Forward call to power iteration implementation.
             this->startMeasureProgress();
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+            uint64_t impreciseIterations = performMixedPrecisionIterations(env, x, b, precision, guarantee);
+            PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, impreciseIterations, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
 
             // Swap the result in place.
             if (currentX == this->cachedRowVector.get()) {
@@ -380,11 +417,282 @@ namespace storm {
                 clearCache();
             }
             
-            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, result.iterations);
+            this->logIterations(result.status == SolverStatus::Converged, result.status == SolverStatus::TerminatedEarly, impreciseIterations + result.iterations);
 
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        uint64_t NativeLinearEquationSolver<ValueType>::performMixedPrecisionIterations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, SolverGuarantee const& guarantee) const {
+            if (!env.solver().native().isMixedPrecisionSet()) {
+                return 0;
+            }
+            // Values obtained in lower precision might violate the guarantee of the initial values.
+            if (guarantee != SolverGuarantee::None) {
+                STORM_LOG_WARN("Not performing iterations in lower precision as the power method needs to approach the solution from one side.");
+                return 0;
+            }
+            if (!mixedPrecisionHelper) {
+                mixedPrecisionHelper = std::make_unique<storm::solver::helper::MixedPrecisionHelper<ValueType>>(*A);
+            }
+            return mixedPrecisionHelper->performIterations(boost::none, x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel);
+        }
+        
+        template<typename ValueType>
+        ValueType NativeLinearEquationSolver<ValueType>::prepareKrylovMethod(Environment const& env, std::vector<ValueType> const& b) const {
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            if (!preconditioner) {
+                preconditioner = std::make_unique<storm::solver::helper::NativePreconditioner<ValueType>>(*A, env.solver().native().getPreconditioner());
+            }
+            
+            // Unlike the fixed point methods, the Krylov subspace methods check the residual ||b - A*x||. In the
+            // relative case, it is compared to the norm of b.
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            if (env.solver().native().getRelativeTerminationCriterion()) {
+                precision *= storm::utility::sqrt(storm::utility::vector::dotProduct(b, b));
+            }
+            return precision;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsBicgstab(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (BiCGSTAB)");
+            
+            ValueType tolerance = prepareKrylovMethod(env, b);
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            uint64_t n = x.size();
+            
+            // The residual r = b - A*x.
+            std::vector<ValueType> r(n);
+            this->multiplier->multiply(env, x, nullptr, r);
+            storm::utility::vector::subtractVectors(b, r, r);
+            std::vector<ValueType> rHat = r;
+            std::vector<ValueType> p(n, storm::utility::zero<ValueType>());
+            std::vector<ValueType> v(n, storm::utility::zero<ValueType>());
+            std::vector<ValueType> preconditioned(n);
+            std::vector<ValueType> t(n);
+            
+            ValueType rho = storm::utility::one<ValueType>();
+            ValueType alpha = storm::utility::one<ValueType>();
+            ValueType omega = storm::utility::one<ValueType>();
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            if (storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance) {
+                status = SolverStatus::Converged;
+            }
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                ValueType newRho = storm::utility::vector::dotProduct(rHat, r);
+                if (storm::utility::isZero(newRho)) {
+                    STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations.");
+                    break;
+                }
+                if (iterations == 0) {
+                    p = r;
+                } else {
+                    // p = r + beta * (p - omega * v)
+                    ValueType beta = (newRho / rho) * (alpha / omega);
+                    storm::utility::vector::addScaledVector(p, v, -omega);
+                    storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(r, p, p, [&beta] (ValueType const& rValue, ValueType const& pValue) -> ValueType { return rValue + beta * pValue; });
+                }
+                rho = std::move(newRho);
+                
+                preconditioner->apply(p, preconditioned);
+                this->multiplier->multiply(env, preconditioned, nullptr, v);
+                ValueType rHatV = storm::utility::vector::dotProduct(rHat, v);
+                if (storm::utility::isZero(rHatV)) {
+                    STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations.");
+                    break;
+                }
+                alpha = rho / rHatV;
+                storm::utility::vector::addScaledVector(x, preconditioned, alpha);
+                
+                // s = r - alpha * v is stored in r.
+                storm::utility::vector::addScaledVector(r, v, -alpha);
+                ++iterations;
+                if (storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance) {
+                    status = SolverStatus::Converged;
+                } else {
+                    preconditioner->apply(r, preconditioned);
+                    this->multiplier->multiply(env, preconditioned, nullptr, t);
+                    ValueType tt = storm::utility::vector::dotProduct(t, t);
+                    omega = storm::utility::isZero(tt) ? storm::utility::zero<ValueType>() : storm::utility::vector::dotProduct(t, r) / tt;
+                    storm::utility::vector::addScaledVector(x, preconditioned, omega);
+                    storm::utility::vector::addScaledVector(r, t, -omega);
+                    if (storm::utility::sqrt(storm::utility::vector::dotProduct(r, r)) <= tolerance) {
+                        status = SolverStatus::Converged;
+                    } else if (storm::utility::isZero(omega)) {
+                        STORM_LOG_WARN("BiCGSTAB stagnated after " << iterations << " iterations.");
+                        break;
+                    }
+                }
+                
+                this->showProgressIterative(iterations);
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsGmres(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (GMRES)");
+            
+            ValueType tolerance = prepareKrylovMethod(env, b);
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            uint64_t restart = std::max<uint64_t>(1, std::min<uint64_t>(env.solver().native().getRestartThreshold(), x.size()));
+            uint64_t n = x.size();
+            
+            // The (orthonormal) basis of the Krylov subspace, the Hessenberg matrix (stored column-wise) and the
+            // Givens rotations that transform it into upper triangular form.
+            std::vector<std::vector<ValueType>> basis(restart + 1, std::vector<ValueType>(n));
+            std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+            std::vector<ValueType> cosines(restart), sines(restart), residualVector(restart + 1), y(restart);
+            std::vector<ValueType> w(n), preconditioned(n);
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress) {
+                // (Re)start with the current residual.
+                this->multiplier->multiply(env, x, nullptr, basis[0]);
+                storm::utility::vector::subtractVectors(b, basis[0], basis[0]);
+                ValueType residualNorm = storm::utility::sqrt(storm::utility::vector::dotProduct(basis[0], basis[0]));
+                if (residualNorm <= tolerance) {
+                    status = SolverStatus::Converged;
+                    break;
+                }
+                storm::utility::vector::scaleVectorInPlace(basis[0], storm::utility::one<ValueType>() / residualNorm);
+                std::fill(residualVector.begin(), residualVector.end(), storm::utility::zero<ValueType>());
+                residualVector[0] = residualNorm;
+                
+                uint64_t dimension = 0;
+                while (dimension < restart && iterations < maxIter) {
+                    std::vector<ValueType>& column = hessenberg[dimension];
+                    preconditioner->apply(basis[dimension], preconditioned);
+                    this->multiplier->multiply(env, preconditioned, nullptr, w);
+                    
+                    // Modified Gram-Schmidt orthogonalization.
+                    for (uint64_t i = 0; i <= dimension; ++i) {
+                        column[i] = storm::utility::vector::dotProduct(w, basis[i]);
+                        storm::utility::vector::addScaledVector(w, basis[i], -column[i]);
+                    }
+                    column[dimension + 1] = storm::utility::sqrt(storm::utility::vector::dotProduct(w, w));
+                    bool lucky = storm::utility::isZero(column[dimension + 1]);
+                    if (!lucky) {
+                        storm::utility::vector::applyPointwise(w, basis[dimension + 1], [&column, &dimension] (ValueType const& value) -> ValueType { return value / column[dimension + 1]; });
+                    }
+                    
+                    // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+                    for (uint64_t i = 0; i < dimension; ++i) {
+                        ValueType tmp = cosines[i] * column[i] + sines[i] * column[i + 1];
+                        column[i + 1] = cosines[i] * column[i + 1] - sines[i] * column[i];
+                        column[i] = std::move(tmp);
+                    }
+                    ValueType denominator = storm::utility::sqrt(column[dimension] * column[dimension] + column[dimension + 1] * column[dimension + 1]);
+                    if (storm::utility::isZero(denominator)) {
+                        cosines[dimension] = storm::utility::one<ValueType>();
+                        sines[dimension] = storm::utility::zero<ValueType>();
+                    } else {
+                        cosines[dimension] = column[dimension] / denominator;
+                        sines[dimension] = column[dimension + 1] / denominator;
+                        column[dimension] = denominator;
+                    }
+                    column[dimension + 1] = storm::utility::zero<ValueType>();
+                    residualVector[dimension + 1] = -sines[dimension] * residualVector[dimension];
+                    residualVector[dimension] = cosines[dimension] * residualVector[dimension];
+                    
+                    ++dimension;
+                    ++iterations;
+                    this->showProgressIterative(iterations);
+                    if (lucky || storm::utility::abs(residualVector[dimension]) <= tolerance) {
+                        break;
+                    }
+                }
+                
+                // Solve the triangular system H*y = g and update x += M^-1 * (V*y).
+                for (uint64_t row = dimension; row > 0; --row) {
+                    uint64_t i = row - 1;
+                    ValueType value = residualVector[i];
+                    for (uint64_t j = i + 1; j < dimension; ++j) {
+                        value -= hessenberg[j][i] * y[j];
+                    }
+                    y[i] = storm::utility::isZero(hessenberg[i][i]) ? storm::utility::zero<ValueType>() : ValueType(value / hessenberg[i][i]);
+                }
+                std::fill(w.begin(), w.end(), storm::utility::zero<ValueType>());
+                for (uint64_t i = 0; i < dimension; ++i) {
+                    storm::utility::vector::addScaledVector(w, basis[i], y[i]);
+                }
+                preconditioner->apply(w, preconditioned);
+                storm::utility::vector::addScaledVector(x, preconditioned, storm::utility::one<ValueType>());
+                
+                if (storm::utility::abs(residualVector[dimension]) <= tolerance) {
+                    status = SolverStatus::Converged;
+                }
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+                STORM_LOG_TRACE("GMRES restart after " << iterations << " iterations with residual " << storm::utility::abs(residualVector[dimension]) << ".");
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsAggregationDisaggregation(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (aggregation-disaggregation)");
+            
+            if (!this->cachedRowVector) {
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            if (!aggregationDisaggregationHelper) {
+                aggregationDisaggregationHelper = std::make_unique<storm::solver::helper::AggregationDisaggregationHelper<ValueType>>(*A);
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            std::vector<ValueType>& previousX = *this->cachedRowVector;
+            
+            uint64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                previousX = x;
+                aggregationDisaggregationHelper->performCycle(x, b, precision);
+                
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(previousX, x, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                this->showProgressIterative(iterations);
+                ++iterations;
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -422,9 +730,11 @@ namespace storm {
             
             bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
             std::vector<ValueType>* tmp;
+            std::vector<ValueType> tmp2;
             if (!useGaussSeidelMultiplication) {
                 cachedRowVector2 = std::make_unique<std::vector<ValueType>>(x.size());
                 tmp = cachedRowVector2.get();
+                tmp2.resize(x.size());
             }
             
             if (!this->multiplier) {
@@ -471,16 +781,15 @@ namespace storm {
                             maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                         }
                     } else {
-                        this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                        // Update both bounds in a single pass over the matrix. The new upper values are swapped into
+                        // the buffer of the upper bound so that only the three buffers above are shuffled around.
+                        this->multiplier->multiply2(env, *lowerX, *upperX, &b, *tmp, tmp2);
                         if (useDiffs) {
                             maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
+                            maxUpperDiff = computeMaxAbsDiff(*upperX, tmp2, this->getRelevantValues());
                         }
                         std::swap(tmp, lowerX);
-                        this->multiplier->multiply(env, *upperX, &b, *tmp);
-                        if (useDiffs) {
-                            maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
-                        }
-                        std::swap(tmp, upperX);
+                        std::swap(*upperX, tmp2);
                     }
                 } else {
                     // In the following iterations, we improve the bound with the greatest difference.
@@ -587,9 +896,9 @@ namespace storm {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular);
             } else {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()), env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::Regular);
             }
 
             // Prepare initial bounds for the solution (if given)
@@ -980,6 +1289,10 @@ namespace storm {
                     return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
                 case NativeLinearEquationSolverMethod::GaussSeidel:
                     return this->solveEquationsSOR(env, x, b, storm::utility::one<ValueType>());
+                case NativeLinearEquationSolverMethod::MulticolorSOR:
+                    return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()), true);
+                case NativeLinearEquationSolverMethod::MulticolorGaussSeidel:
+                    return this->solveEquationsSOR(env, x, b, storm::utility::one<ValueType>(), true);
                 case NativeLinearEquationSolverMethod::Jacobi:
                     return this->solveEquationsJacobi(env, x, b);
                 case NativeLinearEquationSolverMethod::WalkerChae:
@@ -994,6 +1307,12 @@ namespace storm {
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return this->solveEquationsRationalSearch(env, x, b);
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return this->solveEquationsBicgstab(env, x, b);
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return this->solveEquationsGmres(env, x, b);
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return this->solveEquationsAggregationDisaggregation(env, x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
             return false;
@@ -1026,11 +1345,15 @@ namespace storm {
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::clearCache() const {
             jacobiDecomposition.reset();
+            rowColoring.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
             multiplier.reset();
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
+            mixedPrecisionHelper.reset();
+            preconditioner.reset();
+            aggregationDisaggregationHelper.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
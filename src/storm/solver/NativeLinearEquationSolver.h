@@ -10,6 +10,9 @@
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/MixedPrecisionHelper.h"
+#include "storm/solver/helper/NativePreconditioner.h"
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
 
 #include "storm/utility/NumberTraits.h"
 
@@ -55,6 +58,13 @@ namespace storm {
             
             PowerIterationResult performPowerIteration(Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maxIterations, storm::solver::MultiplicationStyle const& multiplicationStyle) const;
             
+            /*!
+             * If requested, performs the bulk of the power method in lower precision (see MixedPrecisionHelper).
+             *
+             * @return The number of iterations that were performed in lower precision.
+             */
+            uint64_t performMixedPrecisionIterations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, SolverGuarantee const& guarantee) const;
+            
             void logIterations(bool converged, bool terminate, uint64_t iterations) const;
             
             virtual uint64_t getMatrixRowCount() const override;
@@ -62,7 +72,7 @@ namespace storm {
 
             NativeLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
 
-            virtual bool solveEquationsSOR(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const;
+            virtual bool solveEquationsSOR(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega, bool multicolor = false) const;
             virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsPower(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -70,6 +80,15 @@ namespace storm {
             virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsBicgstab(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsGmres(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsAggregationDisaggregation(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Prepares the multiplier and the preconditioner used by the Krylov subspace methods and returns the
+             * (absolute) residual norm below which the solution is considered converged.
+             */
+            ValueType prepareKrylovMethod(storm::Environment const& env, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -98,6 +117,9 @@ namespace storm {
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2; // A.getRowCount() rows
             mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
             mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+            mutable std::unique_ptr<storm::solver::helper::MixedPrecisionHelper<ValueType>> mixedPrecisionHelper;
+            mutable std::unique_ptr<storm::solver::helper::NativePreconditioner<ValueType>> preconditioner;
+            mutable std::unique_ptr<storm::solver::helper::AggregationDisaggregationHelper<ValueType>> aggregationDisaggregationHelper;
             
             struct JacobiDecomposition {
                 JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
@@ -108,6 +130,9 @@ namespace storm {
             };
             mutable std::unique_ptr<JacobiDecomposition> jacobiDecomposition;
             
+            // A colouring of the rows of the matrix for the multicolour variants of Gauss-Seidel and SOR.
+            mutable std::unique_ptr<std::vector<std::vector<uint_fast64_t>>> rowColoring;
+            
             struct WalkerChaeData {
                 WalkerChaeData(Environment const& env, storm::storage::SparseMatrix<ValueType> const& originalMatrix, std::vector<ValueType> const& originalB);
                 
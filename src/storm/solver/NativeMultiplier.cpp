@@ -13,6 +13,8 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
@@ -31,6 +33,23 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType>
+        storm::solver::helper::NumaPartitionedMatrix<ValueType> const* NativeMultiplier<ValueType>::getNumaPartitionedMatrix(Environment const& env) const {
+            if (!env.solver().multiplier().isNumaAwarePlacementSet()) {
+                return nullptr;
+            }
+            if (!numaPartitionedMatrix) {
+                numaPartitionedMatrix = std::make_unique<storm::solver::helper::NumaPartitionedMatrix<ValueType>>(this->matrix);
+            }
+            return numaPartitionedMatrix.get();
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            numaPartitionedMatrix.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             std::vector<ValueType>* target = &result;
@@ -43,7 +62,11 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddParallel(x, b, *target);
+                if (auto partitionedMatrix = getNumaPartitionedMatrix(env)) {
+                    partitionedMatrix->multiply(x, b, *target);
+                } else {
+                    multAddParallel(x, b, *target);
+                }
             } else {
                 multAdd(x, b, *target);
             }
@@ -73,7 +96,14 @@ namespace storm {
                 target = this->cachedVector.get();
             }
             if (parallelize(env)) {
-                multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+                // The distributed matrix only knows the row groups of the matrix and does not track choices. Comparing
+                // the row groups by identity avoids a pass over them in every multiplication.
+                auto partitionedMatrix = getNumaPartitionedMatrix(env);
+                if (partitionedMatrix && !choices && &rowGroupIndices == &this->matrix.getRowGroupIndices()) {
+                    partitionedMatrix->multiplyAndReduce(dir, x, b, *target);
+                } else {
+                    multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+                }
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -106,6 +136,124 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multAddReduce2(env, boost::none, this->matrix.getRowGroupIndices(), x1, x2, b, result1, result2, this->matrix.getRowCount());
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const {
+            multAddReduce2(env, dir, rowGroupIndices, x1, x2, b, result1, result2, rowGroupIndices.size() - 1);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduce2(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, uint64_t numberOfGroups) const {
+            STORM_LOG_ASSERT(&result1 != &x1 && &result1 != &x2 && &result2 != &x1 && &result2 != &x2, "Fused multiplications must not be performed in place.");
+#ifdef STORM_HAVE_INTELTBB
+            if (parallelize(env)) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfGroups, 100), [&] (tbb::blocked_range<uint64_t> const& range) {
+                    multAddReduce2(dir, rowGroupIndices, x1, x2, b, result1, result2, range.begin(), range.end());
+                });
+                return;
+            }
+#endif
+            multAddReduce2(dir, rowGroupIndices, x1, x2, b, result1, result2, 0, numberOfGroups);
+        }
+        
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::multAddReduce2(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, uint64_t startGroup, uint64_t endGroup) const {
+            for (uint64_t group = startGroup; group < endGroup; ++group) {
+                uint64_t row = dir ? rowGroupIndices[group] : group;
+                uint64_t const rowEnd = dir ? rowGroupIndices[group + 1] : group + 1;
+                if (row == rowEnd) {
+                    result1[group] = storm::utility::zero<ValueType>();
+                    result2[group] = storm::utility::zero<ValueType>();
+                    continue;
+                }
+                ValueType best1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                ValueType best2 = best1;
+                multiplyRow2(row, x1, best1, x2, best2);
+                for (++row; row < rowEnd; ++row) {
+                    ValueType value1 = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    ValueType value2 = value1;
+                    multiplyRow2(row, x1, value1, x2, value2);
+                    if (minimize(dir.get()) ? value1 < best1 : value1 > best1) {
+                        best1 = std::move(value1);
+                    }
+                    if (minimize(dir.get()) ? value2 < best2 : value2 > best2) {
+                        best2 = std::move(value2);
+                    }
+                }
+                result1[group] = std::move(best1);
+                result2[group] = std::move(best2);
+            }
+        }
+        
+        template<typename ValueType>
+        ValueType NativeMultiplier<ValueType>::multiplyAndComputeDifference(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const {
+            return multAddReduceAndComputeDifference(env, boost::none, this->matrix.getRowGroupIndices(), x, b, result, relative, this->matrix.getRowCount());
+        }
+        
+        template<typename ValueType>
+        ValueType NativeMultiplier<ValueType>::multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const {
+            return multAddReduceAndComputeDifference(env, dir, rowGroupIndices, x, b, result, relative, rowGroupIndices.size() - 1);
+        }
+        
+        template<typename ValueType>
+        ValueType NativeMultiplier<ValueType>::multAddReduceAndComputeDifference(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative, uint64_t numberOfGroups) const {
+            STORM_LOG_ASSERT(&result != &x, "The difference can not be computed for in-place multiplications.");
+            STORM_LOG_ASSERT(x.size() == numberOfGroups, "The number of columns does not match the number of row groups.");
+#ifdef STORM_HAVE_INTELTBB
+            if (parallelize(env)) {
+                return tbb::parallel_reduce(tbb::blocked_range<uint64_t>(0, numberOfGroups, 100), storm::utility::zero<ValueType>(), [&] (tbb::blocked_range<uint64_t> const& range, ValueType const& difference) {
+                    return std::max<ValueType>(difference, multAddReduceAndComputeDifference(dir, rowGroupIndices, x, b, result, relative, range.begin(), range.end()));
+                }, [] (ValueType const& first, ValueType const& second) {
+                    return std::max<ValueType>(first, second);
+                });
+            }
+#endif
+            return multAddReduceAndComputeDifference(dir, rowGroupIndices, x, b, result, relative, 0, numberOfGroups);
+        }
+        
+        template<typename ValueType>
+        ValueType NativeMultiplier<ValueType>::multAddReduceAndComputeDifference(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative, uint64_t startGroup, uint64_t endGroup) const {
+            ValueType maximalDifference = storm::utility::zero<ValueType>();
+            for (uint64_t group = startGroup; group < endGroup; ++group) {
+                uint64_t row = dir ? rowGroupIndices[group] : group;
+                uint64_t const rowEnd = dir ? rowGroupIndices[group + 1] : group + 1;
+                ValueType best = storm::utility::zero<ValueType>();
+                if (row < rowEnd) {
+                    best = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    multiplyRow(row, x, best);
+                    for (++row; row < rowEnd; ++row) {
+                        ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                        multiplyRow(row, x, value);
+                        if (minimize(dir.get()) ? value < best : value > best) {
+                            best = std::move(value);
+                        }
+                    }
+                }
+                ValueType difference = storm::utility::vector::differenceModuloPrecision(x[group], best, relative);
+                if (difference > maximalDifference) {
+                    maximalDifference = std::move(difference);
+                }
+                result[group] = std::move(best);
+            }
+            return maximalDifference;
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        storm::RationalFunction NativeMultiplier<storm::RationalFunction>::multAddReduceAndComputeDifference(Environment const&, boost::optional<storm::solver::OptimizationDirection> const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, bool, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+        
+        template<>
+        storm::RationalFunction NativeMultiplier<storm::RationalFunction>::multAddReduceAndComputeDifference(boost::optional<storm::solver::OptimizationDirection> const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, bool, uint64_t, uint64_t) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             this->matrix.multiplyWithVector(x, result, b);
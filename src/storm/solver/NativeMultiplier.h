@@ -1,8 +1,11 @@
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/helper/NumaPartitionedMatrix.h"
 
 namespace storm {
     namespace storage {
@@ -18,16 +21,28 @@ namespace storm {
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
             virtual ~NativeMultiplier() = default;
             
+            virtual void clearCache() const override;
+            
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
             virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
             virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void multiply2(Environment const& env, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const override;
+            virtual void multiplyAndReduce2(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2) const override;
+            virtual ValueType multiplyAndComputeDifference(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const override;
+            virtual ValueType multiplyAndReduceAndComputeDifference(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative) const override;
 
         private:
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves (and if necessary computes) the copy of the matrix that is distributed over the NUMA nodes of
+             * the threads performing parallel multiplications, if the environment asks for it and null otherwise.
+             */
+            storm::solver::helper::NumaPartitionedMatrix<ValueType> const* getNumaPartitionedMatrix(Environment const& env) const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
@@ -35,6 +50,22 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            /*!
+             * Performs the two multiplications (and reductions if a direction is given) for the row groups (or rows,
+             * if no direction is given) in the given range in a single pass over the matrix.
+             */
+            void multAddReduce2(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, uint64_t startGroup, uint64_t endGroup) const;
+            void multAddReduce2(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x1, std::vector<ValueType> const& x2, std::vector<ValueType> const* b, std::vector<ValueType>& result1, std::vector<ValueType>& result2, uint64_t numberOfGroups) const;
+            
+            /*!
+             * Performs the multiplication (and reduction if a direction is given) for the row groups (or rows, if no
+             * direction is given) in the given range and returns the largest difference between the entries of x and
+             * the result in the same pass over the matrix.
+             */
+            ValueType multAddReduceAndComputeDifference(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative, uint64_t startGroup, uint64_t endGroup) const;
+            ValueType multAddReduceAndComputeDifference(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool relative, uint64_t numberOfGroups) const;
+            
+            mutable std::unique_ptr<storm::solver::helper::NumaPartitionedMatrix<ValueType>> numaPartitionedMatrix;
         };
         
     }
@@ -290,6 +290,14 @@ namespace storm {
              */
             virtual bool unsetTimeout();
             
+            /*!
+             * If supported by the solver, this interrupts a satisfiability query that is currently running, which then
+             * returns an unknown result. This may be called from a different thread than the one using the solver.
+             *
+             * @return True iff the solver supports interrupting queries.
+             */
+            virtual bool interrupt();
+            
 			/*!
 			 * If supported by the solver, this function returns the current assertions in the SMT-LIB format.
 			 *
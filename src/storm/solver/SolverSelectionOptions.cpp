@@ -26,6 +26,8 @@ namespace storm {
                     return "vi-to-pi";
                 case MinMaxMethod::Acyclic:
                     return "vi-to-pi";
+                case MinMaxMethod::PrioritizedValueIteration:
+                    return "prioritizedvalueiteration";
             }
             return "invalid";
         }
@@ -122,6 +124,10 @@ namespace storm {
                     return "GaussSeidel";
                 case NativeLinearEquationSolverMethod::SOR:
                     return "SOR";
+                case NativeLinearEquationSolverMethod::MulticolorGaussSeidel:
+                    return "MulticolorGaussSeidel";
+                case NativeLinearEquationSolverMethod::MulticolorSOR:
+                    return "MulticolorSOR";
                 case NativeLinearEquationSolverMethod::WalkerChae:
                     return "WalkerChae";
                 case NativeLinearEquationSolverMethod::Power:
@@ -134,6 +140,24 @@ namespace storm {
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return "RationalSearch";
+                case NativeLinearEquationSolverMethod::Bicgstab:
+                    return "BiCGSTAB";
+                case NativeLinearEquationSolverMethod::Gmres:
+                    return "GMRES";
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return "AggregationDisaggregation";
+            }
+            return "invalid";
+        }
+        
+        std::string toString(NativeLinearEquationSolverPreconditioner t) {
+            switch (t) {
+                case NativeLinearEquationSolverPreconditioner::Ilu:
+                    return "ilu";
+                case NativeLinearEquationSolverPreconditioner::Diagonal:
+                    return "diagonal";
+                case NativeLinearEquationSolverPreconditioner::None:
+                    return "none";
             }
             return "invalid";
         }
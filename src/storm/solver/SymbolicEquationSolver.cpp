@@ -9,6 +9,9 @@
 namespace storm {
     namespace solver {
         
+        // The number of iterations between two checks of the node count of the solution vector.
+        static const uint64_t nodeCountCheckInterval = 10;
+        
         template<storm::dd::DdType DdType, typename ValueType>
         SymbolicEquationSolver<DdType, ValueType>::SymbolicEquationSolver(storm::dd::Bdd<DdType> const& allRows) : allRows(allRows) {
             // Intentionally left empty.
@@ -121,6 +124,26 @@ namespace storm {
             }
         }
         
+        template<storm::dd::DdType DdType, typename ValueType>
+        bool SymbolicEquationSolver<DdType, ValueType>::isExplicitSolvingRequired(storm::dd::Add<DdType, ValueType> const& values, boost::optional<uint64_t> const& maximalNodeCount, uint64_t iteration) const {
+            if (!maximalNodeCount) {
+                this->getDdManager().checkMemoryBudget("solving equations symbolically");
+                return false;
+            }
+            if (maximalNodeCount.get() > 0 && (iteration - 1) % nodeCountCheckInterval == 0) {
+                uint64_t nodeCount = values.getNodeCount();
+                if (nodeCount > maximalNodeCount.get()) {
+                    STORM_LOG_INFO("Solution vector has " << nodeCount << " nodes, switching to explicit solving.");
+                    return true;
+                }
+            }
+            if (this->getDdManager().isMemoryBudgetExceeded()) {
+                STORM_LOG_WARN("The DD library exceeds the memory budget, switching to explicit solving.");
+                return true;
+            }
+            return false;
+        }
+        
         template class SymbolicEquationSolver<storm::dd::DdType::CUDD, double>;
         template class SymbolicEquationSolver<storm::dd::DdType::Sylvan, double>;
         
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/storage/dd/DdManager.h"
@@ -43,6 +45,21 @@ namespace storm {
 
         protected:
             storm::dd::DdManager<DdType>& getDdManager() const;
+            
+            /*!
+             * Determines whether an iterative solver should stop iterating symbolically and solve the remaining
+             * system explicitly. This is the case if the given values have more than the given number of nodes (zero
+             * meaning no limit) or if the DD library exceeds its memory budget. If no node count is given, i.e. the
+             * solver cannot switch to explicit solving, exceeding the memory budget aborts the computation.
+             * As counting the nodes traverses the whole DD, the node count is only checked in the first and then in
+             * every tenth iteration.
+             *
+             * @param values The current values of the iteration.
+             * @param maximalNodeCount The maximal number of nodes (if the solver can switch to explicit solving).
+             * @param iteration The number of the current iteration (starting at one).
+             * @return True iff the solver should switch to explicit solving.
+             */
+            bool isExplicitSolvingRequired(storm::dd::Add<DdType, ValueType> const& values, boost::optional<uint64_t> const& maximalNodeCount, uint64_t iteration) const;
 
             void setAllRows(storm::dd::Bdd<DdType> const& allRows);
             storm::dd::Bdd<DdType> const& getAllRows() const;
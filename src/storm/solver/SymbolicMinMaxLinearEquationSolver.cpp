@@ -4,6 +4,10 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/solver/MinMaxLinearEquationSolver.h"
 
 #include "storm/utility/constants.h"
 
@@ -70,7 +74,7 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, boost::optional<uint64_t> const& maximalNodeCount) const {
 
             // Set up local variables.
             storm::dd::Add<DdType, ValueType> localX = x;
@@ -99,6 +103,9 @@ namespace storm {
                 // Set up next iteration.
                 localX = tmp;
                 ++iterations;
+                if (status == SolverStatus::InProgress && this->isExplicitSolvingRequired(localX, maximalNodeCount, iterations)) {
+                    status = SolverStatus::TerminatedEarly;
+                }
                 if (storm::utility::resources::isTerminate()) {
                     status = SolverStatus::Aborted;
                 }
@@ -280,9 +287,13 @@ namespace storm {
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), getMaximalNodeCount(env, dir));
             
-            if (viResult.status == SolverStatus::Converged) {
+            if (viResult.status == SolverStatus::TerminatedEarly) {
+                // The solution vector became too large, so we solve the remaining system explicitly.
+                STORM_LOG_INFO("Switching to explicit solving after " << viResult.iterations << " iterations (value iteration).");
+                return solveEquationsExplicitly(env, dir, viResult.values, b);
+            } else if (viResult.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
             } else {
                 STORM_LOG_WARN("Iterative solver (value iteration) did not converge in " << viResult.iterations << " iterations.");
@@ -291,6 +302,56 @@ namespace storm {
             return viResult.values;
         }
         
+        template<storm::dd::DdType DdType, typename ValueType>
+        boost::optional<uint64_t> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::getMaximalNodeCount(Environment const& env, storm::solver::OptimizationDirection const& dir) const {
+            // Exact computations keep being carried out symbolically.
+            if (storm::NumberTraits<ValueType>::IsExact) {
+                return boost::none;
+            }
+            
+            uint64_t result = env.solver().getSymbolicExplicitFallbackThreshold();
+            if (result == 0 && !this->getDdManager().getMemoryBudget()) {
+                return boost::none;
+            }
+            
+            // Only switch if we can satisfy the requirements of the explicit solver.
+            MinMaxLinearEquationSolverRequirements requirements = GeneralMinMaxLinearEquationSolverFactory<ValueType>().getRequirements(env, this->hasUniqueSolution(), false, dir);
+            if (this->hasLowerBound() || this->hasLowerBounds()) {
+                requirements.clearLowerBounds();
+            }
+            if (this->hasUpperBound() || this->hasUpperBounds()) {
+                requirements.clearUpperBounds();
+            }
+            if (requirements.hasEnabledCriticalRequirement()) {
+                STORM_LOG_DEBUG("Not switching to explicit solving, because the requirements " << requirements.getEnabledRequirementsAsString() << " of the explicit solver cannot be met.");
+                return boost::none;
+            }
+            return result;
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Add<DdType, ValueType> SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsExplicitly(Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
+            storm::dd::Odd odd = this->allRows.createOdd();
+            
+            // Every legal choice needs to have a row in the explicit matrix, even if both its transitions and its
+            // value in b are zero. We therefore pass the legal choices as an additional vector to the translation,
+            // which makes sure the corresponding rows are created.
+            storm::dd::Bdd<DdType> legalChoices = !this->illegalMask && this->allRows;
+            storm::dd::Add<DdType, ValueType> legalChoicesAdd = legalChoices.template toAdd<ValueType>();
+            std::vector<uint_fast64_t> rowGroupSizes = legalChoices.template toAdd<uint_fast64_t>().sumAbstract(this->choiceVariables).toVector(odd);
+            auto matrixAndVectors = this->A.toMatrixVectors(std::move(rowGroupSizes), {b * legalChoicesAdd, legalChoicesAdd}, this->rowMetaVariables, this->columnMetaVariables, this->choiceVariables, odd, odd);
+            std::vector<ValueType> explicitX = x.toVector(odd);
+            STORM_LOG_INFO("Solving explicit min-max equation system with " << matrixAndVectors.first.getRowGroupCount() << " row groups, " << matrixAndVectors.first.getRowCount() << " rows and " << matrixAndVectors.first.getEntryCount() << " entries.");
+            
+            std::unique_ptr<MinMaxLinearEquationSolver<ValueType>> solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(env, std::move(matrixAndVectors.first));
+            solver->setHasUniqueSolution(this->hasUniqueSolution());
+            this->forwardBounds(*solver, odd);
+            solver->setRequirementsChecked();
+            solver->solveEquations(env, dir, explicitX, matrixAndVectors.second.front());
+            
+            return storm::dd::Add<DdType, ValueType>::fromVector(this->getDdManager(), explicitX, odd, this->rowMetaVariables);
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType>  SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::solveEquationsWithScheduler(Environment const& env, storm::dd::Bdd<DdType> const& scheduler, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             
@@ -506,6 +567,22 @@ namespace storm {
                 solver.setUpperBounds(this->getUpperBounds());
             }
         }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        void SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::forwardBounds(storm::solver::AbstractEquationSolver<ValueType>& solver, storm::dd::Odd const& odd) const {
+            if (this->hasLowerBound()) {
+                solver.setLowerBound(this->getLowerBound());
+            }
+            if (this->hasLowerBounds()) {
+                solver.setLowerBounds(this->getLowerBounds().toVector(odd));
+            }
+            if (this->hasUpperBound()) {
+                solver.setUpperBound(this->getUpperBound());
+            }
+            if (this->hasUpperBounds()) {
+                solver.setUpperBounds(this->getUpperBounds().toVector(odd));
+            }
+        }
 
         template<storm::dd::DdType DdType, typename ValueType>
         MinMaxLinearEquationSolverRequirements SymbolicMinMaxLinearEquationSolverFactory<DdType, ValueType>::getRequirements(Environment const& env, bool hasUniqueSolution, boost::optional<storm::solver::OptimizationDirection> const& direction) const {
@@ -9,6 +9,7 @@
 #include "storm/solver/SymbolicEquationSolver.h"
 #include "storm/solver/OptimizationDirection.h"
 #include "storm/solver/SymbolicLinearEquationSolver.h"
+#include "storm/solver/AbstractEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolverRequirements.h"
 #include "storm/solver/SolverStatus.h"
 
@@ -28,6 +29,8 @@ namespace storm {
         
         template<storm::dd::DdType T>
         class Bdd;
+        
+        class Odd;
     }
     
     namespace solver {
@@ -167,7 +170,24 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            /*!
+             * Performs value iteration. If a maximal node count is given and explicit solving becomes necessary (see
+             * isExplicitSolvingRequired), the iteration stops early with status TerminatedEarly.
+             */
+            ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, boost::optional<uint64_t> const& maximalNodeCount = boost::none) const;
+            
+            /*!
+             * Retrieves the number of nodes of the solution vector above which value iteration switches to explicit
+             * solving (zero meaning that only exceeding the memory budget triggers the switch). If the solver cannot
+             * switch to explicit solving, none is returned.
+             */
+            boost::optional<uint64_t> getMaximalNodeCount(Environment const& env, storm::solver::OptimizationDirection const& dir) const;
+            
+            /*!
+             * Solves the min-max equation system explicitly, starting from the given values, and translates the
+             * solution back to an ADD.
+             */
+            storm::dd::Add<DdType, ValueType> solveEquationsExplicitly(Environment const& env, storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const;
             
         protected:
             // The matrix defining the coefficients of the linear equation system.
@@ -208,6 +228,11 @@ namespace storm {
              * Forwards the known bounds of this solver to the given linear equation solver.
              */
             void forwardBounds(storm::solver::SymbolicLinearEquationSolver<DdType, ValueType>& solver) const;
+            
+            /*!
+             * Forwards the known bounds of this solver to the given explicit solver whose rows are given by the ODD.
+             */
+            void forwardBounds(storm::solver::AbstractEquationSolver<ValueType>& solver, storm::dd::Odd const& odd) const;
         };
         
         template<storm::dd::DdType DdType, typename ValueType>
@@ -1,10 +1,13 @@
 #include "storm/solver/SymbolicNativeLinearEquationSolver.h"
 
+#include "storm/solver/LinearEquationSolver.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/dd.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -76,6 +79,7 @@ namespace storm {
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
             uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             bool relative = env.solver().native().getRelativeTerminationCriterion();
+            boost::optional<uint64_t> maximalNodeCount = getMaximalNodeCount(env);
             
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (jacobi)");
 
@@ -106,6 +110,12 @@ namespace storm {
                 
                 // Increase iteration count so we can abort if convergence is too slow.
                 ++iterationCount;
+                
+                // If the solution vector became too large, we solve the remaining system explicitly.
+                if (!converged && this->isExplicitSolvingRequired(xCopy, maximalNodeCount, iterationCount)) {
+                    STORM_LOG_INFO("Switching to explicit solving after " << iterationCount << " iterations (jacobi).");
+                    return solveEquationsExplicitly(env, xCopy, b, false);
+                }
             }
             
             if (converged) {
@@ -118,7 +128,7 @@ namespace storm {
         }
         
         template<storm::dd::DdType DdType, typename ValueType>
-        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const {
+        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, boost::optional<uint64_t> const& maximalNodeCount) const {
             
             // Set up additional environment variables.
             storm::dd::Add<DdType, ValueType> currentX = x;
@@ -137,6 +147,10 @@ namespace storm {
                 // Set up next iteration.
                 ++iterations;
                 currentX = tmp;
+                
+                if (status == SolverStatus::InProgress && this->isExplicitSolvingRequired(currentX, maximalNodeCount, iterations)) {
+                    status = SolverStatus::TerminatedEarly;
+                }
             }
 
             return PowerIterationResult(status, iterations, currentX);
@@ -146,9 +160,13 @@ namespace storm {
         storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), getMaximalNodeCount(env));
             
-            if (result.status == SolverStatus::Converged) {
+            if (result.status == SolverStatus::TerminatedEarly) {
+                // The solution vector became too large, so we solve the remaining system explicitly.
+                STORM_LOG_INFO("Switching to explicit solving after " << result.iterations << " iterations (power iteration).");
+                return solveEquationsExplicitly(env, result.values, b, true);
+            } else if (result.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
             } else {
                 STORM_LOG_WARN("Iterative solver (power iteration) did not converge in " << result.iterations << " iterations.");
@@ -157,6 +175,68 @@ namespace storm {
             return result.values;
         }
 
+        template<storm::dd::DdType DdType, typename ValueType>
+        boost::optional<uint64_t> SymbolicNativeLinearEquationSolver<DdType, ValueType>::getMaximalNodeCount(Environment const& env) const {
+            // Exact computations keep being carried out symbolically.
+            if (storm::NumberTraits<ValueType>::IsExact) {
+                return boost::none;
+            }
+            
+            uint64_t result = env.solver().getSymbolicExplicitFallbackThreshold();
+            if (result == 0 && !this->getDdManager().getMemoryBudget()) {
+                return boost::none;
+            }
+            
+            // Only switch if we can satisfy the requirements of the explicit solver.
+            LinearEquationSolverRequirements requirements = GeneralLinearEquationSolverFactory<ValueType>().getRequirements(env);
+            if (this->hasLowerBound() || this->hasLowerBounds()) {
+                requirements.clearLowerBounds();
+            }
+            if (this->hasUpperBound() || this->hasUpperBounds()) {
+                requirements.clearUpperBounds();
+            }
+            if (requirements.hasEnabledCriticalRequirement()) {
+                STORM_LOG_DEBUG("Not switching to explicit solving, because the requirements " << requirements.getEnabledRequirementsAsString() << " of the explicit solver cannot be met.");
+                return boost::none;
+            }
+            return result;
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsExplicitly(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, bool fixedPointSystem) const {
+            GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+            
+            // Bring the matrix into the format required by the explicit solver. As (I - (I - A)) = A, the same
+            // transformation converts in both directions.
+            storm::dd::Add<DdType, ValueType> matrix = this->A;
+            if (fixedPointSystem != (linearEquationSolverFactory.getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::FixedPointSystem)) {
+                matrix = (storm::utility::dd::getRowColumnDiagonal<DdType>(this->getDdManager(), this->rowColumnMetaVariablePairs) && this->allRows).template toAdd<ValueType>() - matrix;
+            }
+            
+            storm::dd::Odd odd = this->allRows.createOdd();
+            storm::storage::SparseMatrix<ValueType> explicitMatrix = matrix.toMatrix(this->rowMetaVariables, this->columnMetaVariables, odd, odd);
+            std::vector<ValueType> explicitX = x.toVector(odd);
+            std::vector<ValueType> explicitB = b.toVector(odd);
+            STORM_LOG_INFO("Solving explicit equation system with " << explicitMatrix.getRowCount() << " rows and " << explicitMatrix.getEntryCount() << " entries.");
+            
+            std::unique_ptr<LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitMatrix));
+            if (this->hasLowerBound()) {
+                solver->setLowerBound(this->getLowerBound());
+            }
+            if (this->hasLowerBounds()) {
+                solver->setLowerBounds(this->getLowerBounds().toVector(odd));
+            }
+            if (this->hasUpperBound()) {
+                solver->setUpperBound(this->getUpperBound());
+            }
+            if (this->hasUpperBounds()) {
+                solver->setUpperBounds(this->getUpperBounds().toVector(odd));
+            }
+            solver->solveEquations(env, explicitX, explicitB);
+            
+            return storm::dd::Add<DdType, ValueType>::fromVector(this->getDdManager(), explicitX, odd, this->rowMetaVariables);
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         bool SymbolicNativeLinearEquationSolver<DdType, ValueType>::isSolutionFixedPoint(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             storm::dd::Add<DdType, ValueType> xAsColumn = x.swapVariables(this->rowColumnMetaVariablePairs);
@@ -101,7 +101,24 @@ namespace storm {
                 storm::dd::Add<DdType, ValueType> values;
             };
             
-            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            /*!
+             * Performs power iteration. If a maximal node count is given and explicit solving becomes necessary (see
+             * isExplicitSolvingRequired), the iteration stops early with status TerminatedEarly.
+             */
+            PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, boost::optional<uint64_t> const& maximalNodeCount = boost::none) const;
+            
+            /*!
+             * Retrieves the number of nodes of the solution vector above which the solver switches to explicit
+             * solving (zero meaning that only exceeding the memory budget triggers the switch). If the solver cannot
+             * switch to explicit solving, none is returned.
+             */
+            boost::optional<uint64_t> getMaximalNodeCount(Environment const& env) const;
+            
+            /*!
+             * Solves the equation system explicitly, starting from the given values, and translates the solution back
+             * to an ADD. Depending on the given flag, the system is interpreted as x = Ax + b or as Ax = b.
+             */
+            storm::dd::Add<DdType, ValueType> solveEquationsExplicitly(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, bool fixedPointSystem) const;
 
         };
         
@@ -0,0 +1,194 @@
+#include "storm/solver/helper/AggregationDisaggregationHelper.h"
+
+#include <algorithm>
+#include <string>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace {
+                // Entries whose magnitude is below this fraction of the largest off-diagonal entry of their row are
+                // considered to be weak couplings that are ignored when forming the blocks.
+                double const couplingThreshold = 0.1;
+
+                // An aggregation is only used if it reduces the number of rows to at most three quarters.
+                uint64_t const minimalReductionNumerator = 3;
+                uint64_t const minimalReductionDenominator = 4;
+
+                uint64_t const maximalNumberOfLevels = 10;
+                uint64_t const maximalNumberOfCoarsestSweeps = 1000;
+
+                /*!
+                 * Performs one Gauss-Seidel sweep for A*x = b and returns the largest change of an entry of x. Rows
+                 * with a zero diagonal entry are left unchanged.
+                 */
+                template<typename ValueType>
+                ValueType performGaussSeidelSweep(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType> const& b) {
+                    ValueType maximalChange = storm::utility::zero<ValueType>();
+                    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                        ValueType diagonal = storm::utility::zero<ValueType>();
+                        ValueType value = b[row];
+                        for (auto const& entry : matrix.getRow(row)) {
+                            if (entry.getColumn() == row) {
+                                diagonal += entry.getValue();
+                            } else {
+                                value -= entry.getValue() * x[entry.getColumn()];
+                            }
+                        }
+                        if (!storm::utility::isZero(diagonal)) {
+                            value /= diagonal;
+                            maximalChange = std::max(maximalChange, storm::utility::abs<ValueType>(value - x[row]));
+                            x[row] = std::move(value);
+                        }
+                    }
+                    return maximalChange;
+                }
+            }
+
+            template<typename ValueType>
+            AggregationDisaggregationHelper<ValueType>::AggregationDisaggregationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : originalMatrix(matrix), residual(matrix.getRowCount()) {
+                while (levels.size() < maximalNumberOfLevels && getMatrix(levels.size()).getRowCount() > 1) {
+                    Level coarseLevel;
+                    if (!aggregate(getMatrix(levels.size()), coarseLevel)) {
+                        break;
+                    }
+                    levels.push_back(std::move(coarseLevel));
+                }
+                STORM_LOG_INFO("Aggregated the " << matrix.getRowCount() << " rows of the equation system in " << levels.size() << " level(s)" << (levels.empty() ? "" : " to " + std::to_string(levels.back().matrix.getRowCount()) + " rows") << ".");
+            }
+
+            template<typename ValueType>
+            bool AggregationDisaggregationHelper<ValueType>::aggregate(storm::storage::SparseMatrix<ValueType> const& matrix, Level& coarseLevel) {
+                uint64_t const rowCount = matrix.getRowCount();
+                ValueType const threshold = storm::utility::convertNumber<ValueType>(couplingThreshold);
+
+                // Build the graph of strong couplings and aggregate its SCCs.
+                storm::storage::SparseMatrixBuilder<ValueType> strongCouplingBuilder(rowCount, rowCount);
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    ValueType largestCoupling = storm::utility::zero<ValueType>();
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != row) {
+                            largestCoupling = std::max(largestCoupling, storm::utility::abs<ValueType>(entry.getValue()));
+                        }
+                    }
+                    ValueType rowThreshold = threshold * largestCoupling;
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() != row && !storm::utility::isZero(entry.getValue()) && storm::utility::abs<ValueType>(entry.getValue()) >= rowThreshold) {
+                            strongCouplingBuilder.addNextValue(row, entry.getColumn(), storm::utility::one<ValueType>());
+                        }
+                    }
+                }
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> blocks(strongCouplingBuilder.build(rowCount, rowCount));
+                uint64_t const blockCount = blocks.size();
+                if (blockCount * minimalReductionDenominator > rowCount * minimalReductionNumerator) {
+                    return false;
+                }
+
+                coarseLevel.blockOfRow.resize(rowCount);
+                for (uint64_t block = 0; block < blockCount; ++block) {
+                    for (auto const& row : blocks.getBlock(block)) {
+                        coarseLevel.blockOfRow[row] = block;
+                    }
+                }
+
+                // The aggregated matrix is P^T * A * P where P is the (0/1) prolongation given by the blocks.
+                storm::storage::SparseMatrixBuilder<ValueType> builder(blockCount, blockCount);
+                std::vector<ValueType> accumulator(blockCount, storm::utility::zero<ValueType>());
+                std::vector<bool> touched(blockCount, false);
+                std::vector<uint64_t> touchedBlocks;
+                for (uint64_t block = 0; block < blockCount; ++block) {
+                    for (auto const& row : blocks.getBlock(block)) {
+                        for (auto const& entry : matrix.getRow(row)) {
+                            uint64_t const targetBlock = coarseLevel.blockOfRow[entry.getColumn()];
+                            if (!touched[targetBlock]) {
+                                touched[targetBlock] = true;
+                                touchedBlocks.push_back(targetBlock);
+                            }
+                            accumulator[targetBlock] += entry.getValue();
+                        }
+                    }
+                    std::sort(touchedBlocks.begin(), touchedBlocks.end());
+                    for (auto const& targetBlock : touchedBlocks) {
+                        if (!storm::utility::isZero(accumulator[targetBlock])) {
+                            builder.addNextValue(block, targetBlock, accumulator[targetBlock]);
+                        }
+                        accumulator[targetBlock] = storm::utility::zero<ValueType>();
+                        touched[targetBlock] = false;
+                    }
+                    touchedBlocks.clear();
+                }
+                coarseLevel.matrix = builder.build(blockCount, blockCount);
+                coarseLevel.b.resize(blockCount);
+                coarseLevel.x.resize(blockCount);
+                coarseLevel.residual.resize(blockCount);
+                return true;
+            }
+
+            template<typename ValueType>
+            void AggregationDisaggregationHelper<ValueType>::performCycle(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision) {
+                performCycle(0, x, b, precision);
+            }
+
+            template<typename ValueType>
+            void AggregationDisaggregationHelper<ValueType>::performCycle(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision) {
+                storm::storage::SparseMatrix<ValueType> const& matrix = getMatrix(level);
+                if (level == levels.size()) {
+                    if (level == 0) {
+                        // Without aggregation, this degenerates to Gauss-Seidel.
+                        performGaussSeidelSweep(matrix, x, b);
+                    } else {
+                        // The coarsest system is (approximately) solved directly.
+                        for (uint64_t sweep = 0; sweep < maximalNumberOfCoarsestSweeps; ++sweep) {
+                            if (performGaussSeidelSweep(matrix, x, b) <= precision) {
+                                break;
+                            }
+                        }
+                    }
+                    return;
+                }
+
+                performGaussSeidelSweep(matrix, x, b);
+
+                // Aggregate the residual.
+                std::vector<ValueType>& currentResidual = level == 0 ? residual : levels[level - 1].residual;
+                matrix.multiplyWithVector(x, currentResidual);
+                storm::utility::vector::subtractVectors(b, currentResidual, currentResidual);
+                Level& coarseLevel = levels[level];
+                std::fill(coarseLevel.b.begin(), coarseLevel.b.end(), storm::utility::zero<ValueType>());
+                for (uint64_t row = 0; row < currentResidual.size(); ++row) {
+                    coarseLevel.b[coarseLevel.blockOfRow[row]] += currentResidual[row];
+                }
+
+                // Solve the aggregated system for the correction and disaggregate it.
+                std::fill(coarseLevel.x.begin(), coarseLevel.x.end(), storm::utility::zero<ValueType>());
+                performCycle(level + 1, coarseLevel.x, coarseLevel.b, precision);
+                for (uint64_t row = 0; row < x.size(); ++row) {
+                    x[row] += coarseLevel.x[coarseLevel.blockOfRow[row]];
+                }
+
+                performGaussSeidelSweep(matrix, x, b);
+            }
+
+            template<typename ValueType>
+            uint64_t AggregationDisaggregationHelper<ValueType>::getNumberOfLevels() const {
+                return levels.size();
+            }
+
+            template<typename ValueType>
+            storm::storage::SparseMatrix<ValueType> const& AggregationDisaggregationHelper<ValueType>::getMatrix(uint64_t level) const {
+                return level == 0 ? originalMatrix : levels[level - 1].matrix;
+            }
+
+            template class AggregationDisaggregationHelper<double>;
+            template class AggregationDisaggregationHelper<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Solves equation systems A*x = b with a multilevel iterative aggregation-disaggregation scheme that is
+             * tailored to nearly completely decomposable systems. The rows are aggregated into blocks that are
+             * strongly connected via strong couplings (i.e. after dropping all entries that are small compared to the
+             * largest off-diagonal entry of their row). One cycle then consists of a Gauss-Seidel sweep, the solution
+             * of the aggregated (coarse) system for the residual, the disaggregation of the resulting correction and
+             * another Gauss-Seidel sweep. The coarse systems are treated the same way as long as the aggregation
+             * reduces their size.
+             */
+            template<typename ValueType>
+            class AggregationDisaggregationHelper {
+            public:
+                /*!
+                 * Builds the hierarchy of aggregated systems.
+                 *
+                 * @param matrix The matrix A of the equation system. It has to outlive the helper.
+                 */
+                AggregationDisaggregationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Performs one aggregation-disaggregation cycle, improving the given solution.
+                 *
+                 * @param x The current solution. Will be overwritten with the improved solution.
+                 * @param b The right-hand side of the equation system.
+                 * @param precision The precision up to which the coarsest system is solved.
+                 */
+                void performCycle(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision);
+
+                /*!
+                 * Retrieves the number of aggregation levels (excluding the original system).
+                 */
+                uint64_t getNumberOfLevels() const;
+
+            private:
+                struct Level {
+                    // The matrix of the aggregated system.
+                    storm::storage::SparseMatrix<ValueType> matrix;
+                    // The block (i.e. row of this level) that each row of the previous level is aggregated into.
+                    std::vector<uint64_t> blockOfRow;
+                    // The right-hand side, solution and residual of this level.
+                    std::vector<ValueType> b;
+                    std::vector<ValueType> x;
+                    std::vector<ValueType> residual;
+                };
+
+                /*!
+                 * Tries to aggregate the rows of the given matrix. Returns false if no (sufficient) reduction is possible.
+                 */
+                static bool aggregate(storm::storage::SparseMatrix<ValueType> const& matrix, Level& coarseLevel);
+
+                void performCycle(uint64_t level, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision);
+
+                storm::storage::SparseMatrix<ValueType> const& getMatrix(uint64_t level) const;
+
+                // The matrix of the original system.
+                storm::storage::SparseMatrix<ValueType> const& originalMatrix;
+
+                // The aggregated systems, starting from the first aggregation of the original system.
+                std::vector<Level> levels;
+
+                // The residual of the original system.
+                std::vector<ValueType> residual;
+            };
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#include "storm/solver/helper/ConvergenceCheckScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace {
+                // The number of iterations between two checks is bounded so that a too optimistic estimate of the
+                // convergence rate does not cause (many) superfluous iterations.
+                uint64_t const maximalCheckInterval = 64;
+            }
+
+            template<typename ValueType>
+            ConvergenceCheckScheduler<ValueType>::ConvergenceCheckScheduler(ValueType const& precision, bool adaptive) : precision(storm::utility::convertNumber<double>(precision)), adaptive(adaptive), nextCheckIteration(0), hasLastCheck(false), lastCheckIteration(0), lastDifference(0.0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            bool ConvergenceCheckScheduler<ValueType>::isCheckDue(uint64_t iteration) const {
+                return !adaptive || iteration >= nextCheckIteration;
+            }
+
+            template<typename ValueType>
+            void ConvergenceCheckScheduler<ValueType>::reportDifference(uint64_t iteration, ValueType const& difference) {
+                if (!adaptive) {
+                    return;
+                }
+                double currentDifference = storm::utility::convertNumber<double>(difference);
+                uint64_t interval = 1;
+
+                // The rate can only be estimated if the differences decrease (and are representable).
+                if (hasLastCheck && iteration > lastCheckIteration && std::isfinite(lastDifference) && currentDifference > precision && currentDifference < lastDifference && precision > 0.0) {
+                    double rate = std::pow(currentDifference / lastDifference, 1.0 / static_cast<double>(iteration - lastCheckIteration));
+                    if (rate > 0.0 && rate < 1.0) {
+                        double remainingIterations = std::log(precision / currentDifference) / std::log(rate);
+                        interval = static_cast<uint64_t>(std::min(std::max(remainingIterations / 2.0, 1.0), static_cast<double>(maximalCheckInterval)));
+                    }
+                }
+
+                hasLastCheck = true;
+                lastCheckIteration = iteration;
+                lastDifference = currentDifference;
+                nextCheckIteration = iteration + interval;
+            }
+
+            template class ConvergenceCheckScheduler<double>;
+            template class ConvergenceCheckScheduler<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Decides in which iterations of an iterative method convergence is checked. Without adaptive checking,
+             * convergence is checked in every iteration. Otherwise, the rate of convergence is estimated from the
+             * differences between successive iterates that were observed in the previous checks. The next check is then
+             * scheduled after half of the estimated number of remaining iterations, so that convergence is checked
+             * rarely while the iterates are far from converging and more often as they approach the precision.
+             */
+            template<typename ValueType>
+            class ConvergenceCheckScheduler {
+            public:
+                /*!
+                 * @param precision The precision up to which the iterates have to agree.
+                 * @param adaptive If not set, convergence is checked in every iteration.
+                 */
+                ConvergenceCheckScheduler(ValueType const& precision, bool adaptive);
+
+                /*!
+                 * Retrieves whether convergence is to be checked in the given iteration.
+                 */
+                bool isCheckDue(uint64_t iteration) const;
+
+                /*!
+                 * Registers the largest difference between two successive iterates that was observed when checking
+                 * convergence in the given iteration and schedules the next check.
+                 */
+                void reportDifference(uint64_t iteration, ValueType const& difference);
+
+            private:
+                double precision;
+                bool adaptive;
+
+                uint64_t nextCheckIteration;
+
+                // The iteration and the difference of the last check (if any).
+                bool hasLastCheck;
+                uint64_t lastCheckIteration;
+                double lastDifference;
+            };
+        }
+    }
+}
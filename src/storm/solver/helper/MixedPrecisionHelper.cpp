@@ -0,0 +1,98 @@
+#include "storm/solver/helper/MixedPrecisionHelper.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            MixedPrecisionHelper<ValueType>::MixedPrecisionHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : rowGroupIndices(matrix.getRowGroupIndices()) {
+                STORM_LOG_THROW(matrix.getColumnCount() <= std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "Iterations in lower precision are not supported for matrices with more than " << std::numeric_limits<uint32_t>::max() << " columns.");
+                rowIndications.reserve(matrix.getRowCount() + 1);
+                columns.reserve(matrix.getEntryCount());
+                values.reserve(matrix.getEntryCount());
+                rowIndications.push_back(0);
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    for (auto const& entry : matrix.getRow(row)) {
+                        columns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                        values.push_back(storm::utility::convertNumber<ImpreciseType>(entry.getValue()));
+                    }
+                    rowIndications.push_back(columns.size());
+                }
+            }
+
+            template<typename ValueType>
+            uint64_t MixedPrecisionHelper<ValueType>::performIterations(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, bool gaussSeidel) const {
+                std::vector<ImpreciseType> impreciseB = storm::utility::vector::convertNumericVector<ImpreciseType>(b);
+                std::vector<ImpreciseType> currentX = storm::utility::vector::convertNumericVector<ImpreciseType>(x);
+                std::vector<ImpreciseType> newX;
+                if (!gaussSeidel) {
+                    newX.resize(currentX.size());
+                }
+
+                // Asking for a precision close to the machine precision of the imprecise type would let the iterations
+                // stagnate, so we stop a couple of digits earlier and leave the rest to the refinement.
+                ImpreciseType achievablePrecision = storm::utility::convertNumber<ImpreciseType>(100.0) * std::numeric_limits<ImpreciseType>::epsilon();
+                ImpreciseType impreciseTypePrecision = std::max(storm::utility::convertNumber<ImpreciseType>(precision), achievablePrecision);
+
+                uint64_t iterations = 0;
+                bool converged = false;
+                while (!converged && iterations < maximalNumberOfIterations) {
+                    if (gaussSeidel) {
+                        converged = performIteration(dir, currentX, impreciseB, currentX, impreciseTypePrecision, relative);
+                    } else {
+                        converged = performIteration(dir, currentX, impreciseB, newX, impreciseTypePrecision, relative);
+                        std::swap(currentX, newX);
+                    }
+                    ++iterations;
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                }
+                STORM_LOG_INFO("Performed " << iterations << " iterations in lower precision" << (converged ? "" : " (not converged)") << ".");
+
+                x = storm::utility::vector::convertNumericVector<ValueType>(currentX);
+                return iterations;
+            }
+
+            template<typename ValueType>
+            bool MixedPrecisionHelper<ValueType>::performIteration(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ImpreciseType> const& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& result, ImpreciseType const& precision, bool relative) const {
+                bool backwards = &x == &result;
+                bool converged = true;
+                uint64_t numberOfGroups = dir ? rowGroupIndices.size() - 1 : rowIndications.size() - 1;
+                for (uint64_t i = 0; i < numberOfGroups; ++i) {
+                    uint64_t group = backwards ? numberOfGroups - 1 - i : i;
+                    uint64_t row = dir ? rowGroupIndices[group] : group;
+                    uint64_t const rowEnd = dir ? rowGroupIndices[group + 1] : group + 1;
+                    ImpreciseType best = storm::utility::zero<ImpreciseType>();
+                    for (bool first = true; row < rowEnd; ++row, first = false) {
+                        ImpreciseType value = b[row];
+                        for (uint64_t entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                            value += values[entry] * x[columns[entry]];
+                        }
+                        if (first || (minimize(dir.get()) ? value < best : value > best)) {
+                            best = value;
+                        }
+                    }
+                    if (converged && !storm::utility::vector::equalModuloPrecision<ImpreciseType>(x[group], best, precision, relative)) {
+                        converged = false;
+                    }
+                    result[group] = best;
+                }
+                return converged;
+            }
+
+            template class MixedPrecisionHelper<double>;
+            template class MixedPrecisionHelper<storm::RationalNumber>;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * Performs the bulk of the iterations of value iteration (or the power method) on a copy of the matrix in a
+             * lower precision (single precision for double, double precision for exact numbers). The result is meant as
+             * a starting point for iterations in the original precision which then perform the usual convergence check.
+             * The copy stores 32 bit column indices and the values in separate arrays, so for double each entry takes
+             * eight instead of sixteen bytes (a MatrixEntry<uint64_t, float> would be padded to sixteen bytes as well).
+             */
+            template<typename ValueType>
+            class MixedPrecisionHelper {
+            public:
+                typedef typename std::conditional<std::is_same<ValueType, double>::value, float, double>::type ImpreciseType;
+
+                MixedPrecisionHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Iterates x' = A*x + b (or x' = min/max(A*x + b) if a direction is given) in the lower precision until two
+                 * subsequent iterations differ by at most the given precision or the maximal number of
+                 * iterations is reached. The precision is capped by what can be achieved in the lower precision.
+                 *
+                 * @param dir If given, the optimization direction that is used to reduce the row groups.
+                 * @param x The initial values. Will be overwritten with the result.
+                 * @param b The vector to add after the multiplication.
+                 * @param precision The precision after which to stop.
+                 * @param relative If set, the precision is interpreted relative to the values, otherwise it is absolute.
+                 * @param maximalNumberOfIterations The maximal number of iterations to perform.
+                 * @param gaussSeidel If set, Gauss-Seidel style multiplications are performed.
+                 * @return The number of performed iterations.
+                 */
+                uint64_t performIterations(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, bool gaussSeidel) const;
+
+            private:
+                /*!
+                 * Performs one iteration. If result and x are the same vector, the row groups are processed backwards and
+                 * updated values are used immediately (Gauss-Seidel), otherwise x remains unchanged (Jacobi).
+                 *
+                 * @return True iff the result equals x modulo the given (relative or absolute) precision.
+                 */
+                bool performIteration(boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ImpreciseType> const& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& result, ImpreciseType const& precision, bool relative) const;
+                
+                // The matrix in the lower precision in compressed row storage.
+                std::vector<uint64_t> rowIndications;
+                std::vector<uint32_t> columns;
+                std::vector<ImpreciseType> values;
+                std::vector<uint64_t> rowGroupIndices;
+            };
+        }
+    }
+}
@@ -0,0 +1,159 @@
+#include "storm/solver/helper/NativePreconditioner.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            NativePreconditioner<ValueType>::NativePreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, storm::solver::NativeLinearEquationSolverPreconditioner type) : type(type) {
+                if (type == storm::solver::NativeLinearEquationSolverPreconditioner::Ilu) {
+                    if (!computeIncompleteLuFactorization(matrix)) {
+                        STORM_LOG_WARN("The incomplete LU factorization encountered a zero pivot. Falling back to the diagonal preconditioner.");
+                        factors = storm::storage::SparseMatrix<ValueType>();
+                        diagonalPositions.clear();
+                        this->type = storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal;
+                    }
+                }
+                if (this->type == storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal) {
+                    computeInverseDiagonal(matrix);
+                }
+            }
+
+            template<typename ValueType>
+            bool NativePreconditioner<ValueType>::computeIncompleteLuFactorization(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                factors = matrix;
+                uint64_t const rowCount = factors.getRowCount();
+                uint64_t const noPosition = std::numeric_limits<uint64_t>::max();
+                auto const firstEntry = factors.begin();
+
+                // Locate the diagonal entries.
+                diagonalPositions.assign(rowCount, noPosition);
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    for (auto entryIt = factors.begin(row), entryIte = factors.end(row); entryIt != entryIte; ++entryIt) {
+                        if (entryIt->getColumn() == row) {
+                            diagonalPositions[row] = entryIt - firstEntry;
+                            break;
+                        }
+                    }
+                    if (diagonalPositions[row] == noPosition) {
+                        return false;
+                    }
+                }
+
+                // Eliminate row by row (IKJ variant), dropping all entries outside of the sparsity pattern of the matrix.
+                std::vector<uint64_t> columnToPosition(factors.getColumnCount(), noPosition);
+                for (uint64_t row = 0; row < rowCount; ++row) {
+                    auto rowIt = factors.begin(row);
+                    auto rowIte = factors.end(row);
+                    for (auto entryIt = rowIt; entryIt != rowIte; ++entryIt) {
+                        columnToPosition[entryIt->getColumn()] = entryIt - firstEntry;
+                    }
+
+                    for (auto entryIt = rowIt; entryIt != rowIte && entryIt->getColumn() < row; ++entryIt) {
+                        uint64_t pivotRow = entryIt->getColumn();
+                        auto pivotIt = firstEntry + diagonalPositions[pivotRow];
+                        if (storm::utility::isZero(pivotIt->getValue())) {
+                            return false;
+                        }
+                        ValueType factor = entryIt->getValue() / pivotIt->getValue();
+                        entryIt->setValue(factor);
+                        for (auto pivotRowIt = pivotIt + 1, pivotRowIte = factors.end(pivotRow); pivotRowIt != pivotRowIte; ++pivotRowIt) {
+                            uint64_t position = columnToPosition[pivotRowIt->getColumn()];
+                            if (position != noPosition) {
+                                auto targetIt = firstEntry + position;
+                                targetIt->setValue(targetIt->getValue() - factor * pivotRowIt->getValue());
+                            }
+                        }
+                    }
+
+                    if (storm::utility::isZero((firstEntry + diagonalPositions[row])->getValue())) {
+                        return false;
+                    }
+                    for (auto entryIt = rowIt; entryIt != rowIte; ++entryIt) {
+                        columnToPosition[entryIt->getColumn()] = noPosition;
+                    }
+                }
+                return true;
+            }
+
+            template<typename ValueType>
+            void NativePreconditioner<ValueType>::computeInverseDiagonal(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                inverseDiagonal.assign(matrix.getRowCount(), storm::utility::one<ValueType>());
+                bool hasZeroDiagonalEntries = false;
+                for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                    bool foundDiagonal = false;
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (entry.getColumn() == row) {
+                            if (!storm::utility::isZero(entry.getValue())) {
+                                inverseDiagonal[row] = storm::utility::one<ValueType>() / entry.getValue();
+                                foundDiagonal = true;
+                            }
+                            break;
+                        }
+                    }
+                    hasZeroDiagonalEntries |= !foundDiagonal;
+                }
+                STORM_LOG_WARN_COND(!hasZeroDiagonalEntries, "The matrix has zero diagonal entries. These are left unscaled by the diagonal preconditioner.");
+            }
+
+            template<typename ValueType>
+            void NativePreconditioner<ValueType>::apply(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const {
+                switch (type) {
+                    case storm::solver::NativeLinearEquationSolverPreconditioner::None:
+                        if (&vector != &result) {
+                            result = vector;
+                        }
+                        break;
+                    case storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal:
+                        for (uint64_t row = 0; row < vector.size(); ++row) {
+                            result[row] = inverseDiagonal[row] * vector[row];
+                        }
+                        break;
+                    case storm::solver::NativeLinearEquationSolverPreconditioner::Ilu: {
+                        if (&vector != &result) {
+                            result = vector;
+                        }
+                        auto const firstEntry = factors.begin();
+                        uint64_t const rowCount = factors.getRowCount();
+
+                        // Forward substitution with the unit lower triangle.
+                        for (uint64_t row = 0; row < rowCount; ++row) {
+                            ValueType value = result[row];
+                            for (auto entryIt = factors.begin(row), diagonalIt = firstEntry + diagonalPositions[row]; entryIt != diagonalIt; ++entryIt) {
+                                value -= entryIt->getValue() * result[entryIt->getColumn()];
+                            }
+                            result[row] = std::move(value);
+                        }
+
+                        // Backward substitution with the upper triangle.
+                        for (uint64_t row = rowCount; row > 0; --row) {
+                            uint64_t const currentRow = row - 1;
+                            auto diagonalIt = firstEntry + diagonalPositions[currentRow];
+                            ValueType value = result[currentRow];
+                            for (auto entryIt = diagonalIt + 1, entryIte = factors.end(currentRow); entryIt != entryIte; ++entryIt) {
+                                value -= entryIt->getValue() * result[entryIt->getColumn()];
+                            }
+                            result[currentRow] = value / diagonalIt->getValue();
+                        }
+                        break;
+                    }
+                }
+            }
+
+            template<typename ValueType>
+            storm::solver::NativeLinearEquationSolverPreconditioner NativePreconditioner<ValueType>::getType() const {
+                return type;
+            }
+
+            template class NativePreconditioner<double>;
+            template class NativePreconditioner<storm::RationalNumber>;
+        }
+    }
+}
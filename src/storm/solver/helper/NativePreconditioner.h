@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/solver/SolverSelectionOptions.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * A preconditioner M for the Krylov subspace methods of the native linear equation solver. Applying the
+             * preconditioner to a vector r computes M^-1 * r. Supported are an incomplete LU factorization without
+             * fill-in (ILU(0)) and a diagonal (Jacobi) preconditioner.
+             */
+            template<typename ValueType>
+            class NativePreconditioner {
+            public:
+                /*!
+                 * Sets up the preconditioner for the given matrix. If the matrix has missing or zero diagonal entries,
+                 * ILU(0) falls back to the diagonal preconditioner and the diagonal preconditioner treats the
+                 * corresponding entries as one.
+                 *
+                 * @param matrix The (square) matrix of the equation system.
+                 * @param type The preconditioning technique to use.
+                 */
+                NativePreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, storm::solver::NativeLinearEquationSolverPreconditioner type);
+
+                /*!
+                 * Computes result = M^-1 * vector. The two vectors may be the same.
+                 */
+                void apply(std::vector<ValueType> const& vector, std::vector<ValueType>& result) const;
+
+                /*!
+                 * Retrieves the preconditioning technique that is actually used.
+                 */
+                storm::solver::NativeLinearEquationSolverPreconditioner getType() const;
+
+            private:
+                /*!
+                 * Computes the ILU(0) factorization in place of a copy of the matrix. Returns false if a (missing or)
+                 * zero pivot was encountered.
+                 */
+                bool computeIncompleteLuFactorization(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                void computeInverseDiagonal(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                storm::solver::NativeLinearEquationSolverPreconditioner type;
+
+                // The factors of the ILU(0) factorization. The strict lower triangle holds L (with unit diagonal) and
+                // the upper triangle (including the diagonal) holds U.
+                storm::storage::SparseMatrix<ValueType> factors;
+
+                // For each row the offset of the diagonal entry within the factors.
+                std::vector<uint64_t> diagonalPositions;
+
+                // The inverted diagonal entries (for the diagonal preconditioner).
+                std::vector<ValueType> inverseDiagonal;
+            };
+        }
+    }
+}
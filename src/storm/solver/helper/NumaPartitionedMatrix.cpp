@@ -0,0 +1,282 @@
+#include "storm/solver/helper/NumaPartitionedMatrix.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            namespace {
+#if defined(STORM_HAVE_INTELTBB) && defined(__linux__)
+                /*!
+                 * Retrieves the CPUs of the system ordered by their NUMA node (as reported by sysfs). If the nodes can not
+                 * be determined, the CPUs are returned in their natural order.
+                 */
+                std::vector<int> getCpusOrderedByNode() {
+                    std::vector<int> cpus;
+                    for (uint64_t node = 0; ; ++node) {
+                        std::ifstream cpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                        if (!cpuList.good()) {
+                            break;
+                        }
+                        // The list has the form "0-7,16-23".
+                        std::string range;
+                        while (std::getline(cpuList, range, ',')) {
+                            std::istringstream rangeStream(range);
+                            int first, last;
+                            char separator;
+                            if (!(rangeStream >> first)) {
+                                continue;
+                            }
+                            last = (rangeStream >> separator >> last) ? last : first;
+                            for (int cpu = first; cpu <= last; ++cpu) {
+                                cpus.push_back(cpu);
+                            }
+                        }
+                    }
+                    if (cpus.empty()) {
+                        for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); ++cpu) {
+                            cpus.push_back(cpu);
+                        }
+                    }
+                    return cpus;
+                }
+
+                /*!
+                 * Retrieves the CPUs the calling thread may run on.
+                 */
+                std::vector<int> getAllowedCpus() {
+                    std::vector<int> cpus;
+                    cpu_set_t cpuSet;
+                    CPU_ZERO(&cpuSet);
+                    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) == 0) {
+                        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                            if (CPU_ISSET(cpu, &cpuSet)) {
+                                cpus.push_back(cpu);
+                            }
+                        }
+                    }
+                    return cpus;
+                }
+
+                /*!
+                 * Restricts the calling thread to the given CPUs.
+                 */
+                bool setAllowedCpus(std::vector<int> const& cpus) {
+                    cpu_set_t cpuSet;
+                    CPU_ZERO(&cpuSet);
+                    for (int cpu : cpus) {
+                        CPU_SET(cpu, &cpuSet);
+                    }
+                    return sched_setaffinity(0, sizeof(cpu_set_t), &cpuSet) == 0;
+                }
+#endif
+            }
+
+#ifdef STORM_HAVE_INTELTBB
+            template<typename ValueType>
+            NumaPartitionedMatrix<ValueType>::ThreadPinningObserver::ThreadPinningObserver(tbb::task_arena& arena) : tbb::task_scheduler_observer(arena) {
+#ifdef __linux__
+                cpus = getCpusOrderedByNode();
+                processCpus = getAllowedCpus();
+#else
+                STORM_LOG_WARN("Pinning threads is not supported on this platform.");
+#endif
+                observe(true);
+            }
+
+            template<typename ValueType>
+            NumaPartitionedMatrix<ValueType>::ThreadPinningObserver::~ThreadPinningObserver() {
+                observe(false);
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::ThreadPinningObserver::on_scheduler_entry(bool) {
+#ifdef __linux__
+                int index = tbb::this_task_arena::current_thread_index();
+                if (index < 0 || cpus.empty()) {
+                    return;
+                }
+                if (!setAllowedCpus({cpus[index % cpus.size()]})) {
+                    STORM_LOG_DEBUG("Unable to pin thread " << index << " to CPU " << cpus[index % cpus.size()] << ".");
+                }
+#endif
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::ThreadPinningObserver::on_scheduler_exit(bool) {
+#ifdef __linux__
+                if (!cpus.empty() && !processCpus.empty() && !setAllowedCpus(processCpus)) {
+                    STORM_LOG_DEBUG("Unable to unpin thread " << tbb::this_task_arena::current_thread_index() << ".");
+                }
+#endif
+            }
+#endif
+
+            template<typename ValueType>
+            NumaPartitionedMatrix<ValueType>::NumaPartitionedMatrix(storm::storage::SparseMatrix<ValueType> const& matrix) {
+#ifdef STORM_HAVE_INTELTBB
+                arena.initialize();
+                pinningObserver = std::make_unique<ThreadPinningObserver>(arena);
+                uint64_t numberOfPartitions = std::max<int>(arena.max_concurrency(), 1);
+#else
+                uint64_t numberOfPartitions = 1;
+#endif
+                // Split the row groups such that every partition gets roughly the same number of rows and entries.
+                std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+                uint64_t const rowGroupCount = matrix.getRowGroupCount();
+                uint64_t const totalCost = matrix.getRowCount() + matrix.getEntryCount();
+                std::vector<uint64_t> startGroups = {0};
+                uint64_t cost = 0;
+                for (uint64_t group = 0; group < rowGroupCount && startGroups.size() < numberOfPartitions; ++group) {
+                    cost += (rowGroupIndices[group + 1] - rowGroupIndices[group]) + (matrix.begin(rowGroupIndices[group + 1]) - matrix.begin(rowGroupIndices[group]));
+                    if (cost * numberOfPartitions >= totalCost * startGroups.size()) {
+                        startGroups.push_back(group + 1);
+                    }
+                }
+                while (startGroups.size() < numberOfPartitions) {
+                    startGroups.push_back(rowGroupCount);
+                }
+                startGroups.push_back(rowGroupCount);
+
+                // Let each thread allocate (and thereby first-touch) the partition it processes.
+                partitions.resize(numberOfPartitions);
+#ifdef STORM_HAVE_INTELTBB
+                arena.execute([&] {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfPartitions, 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            fillPartition(matrix, index, startGroups[index], startGroups[index + 1]);
+                        }
+                    }, affinityPartitioner);
+                });
+#else
+                for (uint64_t index = 0; index < numberOfPartitions; ++index) {
+                    fillPartition(matrix, index, startGroups[index], startGroups[index + 1]);
+                }
+#endif
+                STORM_LOG_INFO("Distributed the " << rowGroupCount << " row groups of the matrix over " << numberOfPartitions << " partitions.");
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::fillPartition(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t index, uint64_t startGroup, uint64_t endGroup) {
+                std::vector<uint64_t> const& rowGroupIndices = matrix.getRowGroupIndices();
+                Partition& partition = partitions[index];
+                partition.startGroup = startGroup;
+                partition.endGroup = endGroup;
+                partition.startRow = rowGroupIndices[startGroup];
+                partition.endRow = rowGroupIndices[endGroup];
+
+                partition.rowGroupIndications.reserve(endGroup - startGroup + 1);
+                for (uint64_t group = startGroup; group <= endGroup; ++group) {
+                    partition.rowGroupIndications.push_back(rowGroupIndices[group] - partition.startRow);
+                }
+
+                auto const firstEntry = matrix.begin(partition.startRow);
+                partition.rowIndications.reserve(partition.endRow - partition.startRow + 1);
+                for (uint64_t row = partition.startRow; row <= partition.endRow; ++row) {
+                    partition.rowIndications.push_back(matrix.begin(row) - firstEntry);
+                }
+                partition.entries.assign(firstEntry, matrix.begin(partition.endRow));
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+                STORM_LOG_ASSERT(&x != &result, "The multiplication can not be performed in place.");
+#ifdef STORM_HAVE_INTELTBB
+                arena.execute([&] {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, partitions.size(), 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            multiplyPartition(partitions[index], x, b, result);
+                        }
+                    }, affinityPartitioner);
+                });
+#else
+                for (auto const& partition : partitions) {
+                    multiplyPartition(partition, x, b, result);
+                }
+#endif
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+                STORM_LOG_ASSERT(&x != &result, "The multiplication can not be performed in place.");
+#ifdef STORM_HAVE_INTELTBB
+                arena.execute([&] {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, partitions.size(), 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            multiplyAndReducePartition(partitions[index], dir, x, b, result);
+                        }
+                    }, affinityPartitioner);
+                });
+#else
+                for (auto const& partition : partitions) {
+                    multiplyAndReducePartition(partition, dir, x, b, result);
+                }
+#endif
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::multiplyPartition(Partition const& partition, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+                auto entryIt = partition.entries.begin();
+                auto rowIt = partition.rowIndications.begin();
+                for (uint64_t row = partition.startRow; row < partition.endRow; ++row, ++rowIt) {
+                    ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                    for (auto entryIte = partition.entries.begin() + *(rowIt + 1); entryIt != entryIte; ++entryIt) {
+                        value += entryIt->getValue() * x[entryIt->getColumn()];
+                    }
+                    result[row] = std::move(value);
+                }
+            }
+
+            template<typename ValueType>
+            void NumaPartitionedMatrix<ValueType>::multiplyAndReducePartition(Partition const& partition, storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+                auto entryIt = partition.entries.begin();
+                auto rowIt = partition.rowIndications.begin();
+                auto rowGroupIt = partition.rowGroupIndications.begin();
+                uint64_t row = partition.startRow;
+                for (uint64_t group = partition.startGroup; group < partition.endGroup; ++group, ++rowGroupIt) {
+                    uint64_t const rowEnd = partition.startRow + *(rowGroupIt + 1);
+                    if (row == rowEnd) {
+                        continue;
+                    }
+                    ValueType best;
+                    for (bool first = true; row < rowEnd; ++row, ++rowIt) {
+                        ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+                        for (auto entryIte = partition.entries.begin() + *(rowIt + 1); entryIt != entryIte; ++entryIt) {
+                            value += entryIt->getValue() * x[entryIt->getColumn()];
+                        }
+                        if (first || (minimize(dir) ? value < best : value > best)) {
+                            best = std::move(value);
+                            first = false;
+                        }
+                    }
+                    result[group] = std::move(best);
+                }
+            }
+
+            template<typename ValueType>
+            uint64_t NumaPartitionedMatrix<ValueType>::getNumberOfPartitions() const {
+                return partitions.size();
+            }
+
+            template class NumaPartitionedMatrix<double>;
+#ifdef STORM_HAVE_CARL
+            template class NumaPartitionedMatrix<storm::RationalNumber>;
+            template class NumaPartitionedMatrix<storm::RationalFunction>;
+#endif
+        }
+    }
+}
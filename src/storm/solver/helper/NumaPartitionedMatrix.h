@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/partitioner.h"
+#include "tbb/task_arena.h"
+#include "tbb/task_scheduler_observer.h"
+#endif
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * A copy of a matrix that is split into one chunk of consecutive row groups per thread used for parallel
+             * multiplications. Each chunk is allocated and filled by the thread that later processes it, so that (under
+             * the first-touch policy of the operating system) its memory resides on the NUMA node of this thread. All
+             * operations run in a task arena owned by this matrix. To keep threads on their nodes, the threads of this
+             * arena are pinned to the cores (ordered by NUMA node) while they are in the arena and the assignment of
+             * chunks to threads is replayed in all multiplications.
+             */
+            template<typename ValueType>
+            class NumaPartitionedMatrix {
+            public:
+                /*!
+                 * Distributes the given matrix over the worker threads.
+                 *
+                 * @param matrix The matrix. Only the row groups of this matrix can be used in reductions.
+                 */
+                NumaPartitionedMatrix(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Computes result = A*x + b. The result must not be the same as x.
+                 */
+                void multiply(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+                /*!
+                 * Computes result = min/max(A*x + b) where the minimum/maximum is taken over the row groups of the matrix.
+                 * Entries of the result that correspond to empty row groups are left unchanged. The result must not be
+                 * the same as x.
+                 */
+                void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+                /*!
+                 * Retrieves the number of chunks the matrix was split into.
+                 */
+                uint64_t getNumberOfPartitions() const;
+
+            private:
+                struct Partition {
+                    uint64_t startGroup;
+                    uint64_t endGroup;
+                    uint64_t startRow;
+                    uint64_t endRow;
+
+                    // The offsets of the rows (within the entries) and of the row groups (within the rows) of this chunk.
+                    std::vector<uint64_t> rowIndications;
+                    std::vector<uint64_t> rowGroupIndications;
+                    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> entries;
+                };
+
+                /*!
+                 * Copies the given part of the matrix into the partition with the given index.
+                 */
+                void fillPartition(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t index, uint64_t startGroup, uint64_t endGroup);
+
+                void multiplyPartition(Partition const& partition, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+                void multiplyAndReducePartition(Partition const& partition, storm::solver::OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+
+                std::vector<Partition> partitions;
+
+#ifdef STORM_HAVE_INTELTBB
+                /*!
+                 * Pins each thread entering the observed arena to a CPU, filling the NUMA nodes one after the other. The
+                 * previous affinity of the thread is restored when it leaves the arena.
+                 */
+                class ThreadPinningObserver : public tbb::task_scheduler_observer {
+                public:
+                    ThreadPinningObserver(tbb::task_arena& arena);
+                    virtual ~ThreadPinningObserver();
+
+                    virtual void on_scheduler_entry(bool) override;
+                    virtual void on_scheduler_exit(bool) override;
+
+                private:
+                    std::vector<int> cpus;
+                    std::vector<int> processCpus;
+                };
+
+                // The arena in which all operations on the partitions are performed.
+                mutable tbb::task_arena arena;
+                // Pins the threads of the arena (and only those). Declared after the arena, so it stops observing first.
+                std::unique_ptr<ThreadPinningObserver> pinningObserver;
+                // Records the threads that filled the partitions, so that all multiplications replay this assignment.
+                mutable tbb::affinity_partitioner affinityPartitioner;
+#endif
+            };
+        }
+    }
+}
@@ -5,6 +5,9 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -14,7 +17,7 @@ namespace storm {
         namespace helper {
             
             template<typename ValueType>
-            SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision) : x(x), y(y), hasLowerBound(false), hasUpperBound(false), hasDecisionValue(false), convergencePhase1(true), decisionValueBlocks(false), firstIndexViolatingConvergence(0), minIndex(0), maxIndex(0), relative(relative), precision(precision), rowGroupIndices(nullptr) {
+            SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision, bool jacobi) : x(x), y(y), hasLowerBound(false), hasUpperBound(false), hasDecisionValue(false), convergencePhase1(true), decisionValueBlocks(false), firstIndexViolatingConvergence(0), minIndex(0), maxIndex(0), relative(relative), precision(precision), rowGroupIndices(nullptr), parallel(useParallelIterations(jacobi)) {
                 STORM_LOG_THROW(matrix.getEntryCount() < std::numeric_limits<IndexType>::max(), storm::exceptions::NotSupportedException, "The number of matrix entries is too large for the selected index type.");
                 if (!matrix.hasTrivialRowGrouping()) {
                     rowGroupIndices = &matrix.getRowGroupIndices();
@@ -43,7 +46,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(SoundValueIterationHelper<ValueType>&& oldHelper, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision) : x(x), y(y), xTmp(std::move(oldHelper.xTmp)), yTmp(std::move(oldHelper.yTmp)), hasLowerBound(false), hasUpperBound(false), hasDecisionValue(false), convergencePhase1(true), decisionValueBlocks(false), firstIndexViolatingConvergence(0), minIndex(0), maxIndex(0), relative(relative), precision(precision), numRows(std::move(oldHelper.numRows)), matrixValues(std::move(oldHelper.matrixValues)), matrixColumns(std::move(oldHelper.matrixColumns)), rowIndications(std::move(oldHelper.rowIndications)), rowGroupIndices(oldHelper.rowGroupIndices) {
+            SoundValueIterationHelper<ValueType>::SoundValueIterationHelper(SoundValueIterationHelper<ValueType>&& oldHelper, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision, bool jacobi) : x(x), y(y), xTmp(std::move(oldHelper.xTmp)), yTmp(std::move(oldHelper.yTmp)), hasLowerBound(false), hasUpperBound(false), hasDecisionValue(false), convergencePhase1(true), decisionValueBlocks(false), firstIndexViolatingConvergence(0), minIndex(0), maxIndex(0), relative(relative), precision(precision), numRows(std::move(oldHelper.numRows)), matrixValues(std::move(oldHelper.matrixValues)), matrixColumns(std::move(oldHelper.matrixColumns)), rowIndications(std::move(oldHelper.rowIndications)), rowGroupIndices(oldHelper.rowGroupIndices), parallel(useParallelIterations(jacobi)) {
                 
                 // If x0 is the obtained result, we want x0-eps <= x <= x0+eps for the actual solution x. Hence, the difference between the lower and upper bounds can be 2*eps.
                 this->precision *= storm::utility::convertNumber<ValueType>(2.0);
@@ -52,6 +55,16 @@ namespace storm {
             }
             
             
+            template<typename ValueType>
+            bool SoundValueIterationHelper<ValueType>::useParallelIterations(bool jacobi) {
+#ifdef STORM_HAVE_INTELTBB
+                // Parallel steps change the order of the updates, so they are only used if Jacobi style steps were requested.
+                return jacobi && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+                return false;
+#endif
+            }
+            
             template<typename ValueType>
             void SoundValueIterationHelper<ValueType>::setLowerBound(ValueType const& value) {
                 STORM_LOG_TRACE("Set lower bound to " << value << ".");
@@ -68,6 +81,11 @@ namespace storm {
             
             template<typename ValueType>
             void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi) {
+                multiplyRow(rowIndex, bi, x, y, xi, yi);
+            }
+            
+            template<typename ValueType>
+            void SoundValueIterationHelper<ValueType>::multiplyRow(IndexType const& rowIndex, ValueType const& bi, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xi, ValueType& yi) const {
                 assert(rowIndex < numRows);
                 ValueType xRes = bi;
                 ValueType yRes = storm::utility::zero<ValueType>();
@@ -76,8 +94,8 @@ namespace storm {
                 auto entryItE = matrixValues.begin() + rowIndications[rowIndex + 1];
                 auto colIt = matrixColumns.begin() + rowIndications[rowIndex];
                 for (; entryIt != entryItE; ++entryIt, ++colIt) {
-                    xRes += *entryIt * x[*colIt];
-                    yRes += *entryIt * y[*colIt];
+                    xRes += *entryIt * xSource[*colIt];
+                    yRes += *entryIt * ySource[*colIt];
                 }
                 xi = std::move(xRes);
                 yi = std::move(yRes);
@@ -98,6 +116,10 @@ namespace storm {
             
             template<typename ValueType>
             void SoundValueIterationHelper<ValueType>::performIterationStep(std::vector<ValueType> const& b) {
+                if (parallel) {
+                    performIterationStepParallel<InternalOptimizationDirection::None>(b);
+                    return;
+                }
                 auto xIt = x.rbegin();
                 auto yIt = y.rbegin();
                 IndexType row = numRows;
@@ -112,7 +134,9 @@ namespace storm {
             template<typename ValueType>
             template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
             void SoundValueIterationHelper<ValueType>::performIterationStep(std::vector<ValueType> const& b) {
-                if (!decisionValueBlocks) {
+                if (parallel) {
+                    performIterationStepParallel<dir>(b);
+                } else if (!decisionValueBlocks) {
                     performIterationStepUpdateDecisionValue<dir>(b);
                 } else {
                     assert(decisionValue == getPrimaryBound<dir>());
@@ -122,33 +146,7 @@ namespace storm {
                     uint64_t groupEnd = *groupStartIt;
                     ++groupStartIt;
                     for (auto groupStartIte = rowGroupIndices->rend(); groupStartIt != groupStartIte; groupEnd = *(groupStartIt++), ++xIt, ++yIt) {
-                        // Perform the iteration for the first row in the group
-                        IndexType row = *groupStartIt;
-                        ValueType xBest, yBest;
-                        multiplyRow(row, b[row], xBest, yBest);
-                        ++row;
-                        // Only do more work if there are still rows in this row group
-                        if (row != groupEnd) {
-                            ValueType xi, yi;
-                            ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
-                            for (;row < groupEnd; ++row) {
-                                // Get the multiplication results
-                                multiplyRow(row, b[row], xi, yi);
-                                ValueType currentValue = xi + yi * getPrimaryBound<dir>();
-                                // Check if the current row is better then the previously found one
-                                if (better<dir>(currentValue, bestValue)) {
-                                    xBest = std::move(xi);
-                                    yBest = std::move(yi);
-                                    bestValue = std::move(currentValue);
-                                } else if (currentValue == bestValue && yBest > yi) {
-                                    // If the value for this row is not strictly better, it might still be equal and have a better y value
-                                    xBest = std::move(xi);
-                                    yBest = std::move(yi);
-                                }
-                            }
-                        }
-                        *xIt = std::move(xBest);
-                        *yIt = std::move(yBest);
+                        processRowGroup<dir>(*groupStartIt, groupEnd, b, x, y, *xIt, *yIt);
                     }
                 }
             }
@@ -162,52 +160,72 @@ namespace storm {
                 uint64_t groupEnd = *groupStartIt;
                 ++groupStartIt;
                 for (auto groupStartIte = rowGroupIndices->rend(); groupStartIt != groupStartIte; groupEnd = *(groupStartIt++), ++xIt, ++yIt) {
-                    // Perform the iteration for the first row in the group
-                    uint64_t row = *groupStartIt;
-                    ValueType xBest, yBest;
-                    multiplyRow(row, b[row], xBest, yBest);
-                    ++row;
-                    // Only do more work if there are still rows in this row group
-                    if (row != groupEnd) {
-                        ValueType xi, yi;
-                        uint64_t xyTmpIndex = 0;
-                        if (hasPrimaryBound<dir>()) {
-                            ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
-                            for (;row < groupEnd; ++row) {
-                                // Get the multiplication results
-                                multiplyRow(row, b[row], xi, yi);
-                                ValueType currentValue = xi + yi * getPrimaryBound<dir>();
-                                // Check if the current row is better then the previously found one
-                                if (better<dir>(currentValue, bestValue)) {
-                                    if (yBest < yi) {
-                                        // We need to store the 'old' best value as it might be relevant for the decision value
-                                        xTmp[xyTmpIndex] = std::move(xBest);
-                                        yTmp[xyTmpIndex] = std::move(yBest);
-                                        ++xyTmpIndex;
-                                    }
-                                    xBest = std::move(xi);
-                                    yBest = std::move(yi);
-                                    bestValue = std::move(currentValue);
-                                } else if (yBest > yi) {
-                                    // If the value for this row is not strictly better, it might still be equal and have a better y value
-                                    if (currentValue == bestValue) {
-                                        xBest = std::move(xi);
-                                        yBest = std::move(yi);
-                                    } else {
-                                        xTmp[xyTmpIndex] = std::move(xi);
-                                        yTmp[xyTmpIndex] = std::move(yi);
-                                        ++xyTmpIndex;
-                                    }
+                    processRowGroupUpdateDecisionValue<dir>(*groupStartIt, groupEnd, b, x, y, *xIt, *yIt, xTmp, yTmp, hasDecisionValue, decisionValue);
+                }
+            }
+            
+            template<typename ValueType>
+            template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+            void SoundValueIterationHelper<ValueType>::processRowGroup(uint64_t row, uint64_t groupEnd, std::vector<ValueType> const& b, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xResult, ValueType& yResult) const {
+                // Perform the iteration for the first row in the group
+                ValueType xBest, yBest;
+                multiplyRow(row, b[row], xSource, ySource, xBest, yBest);
+                ++row;
+                // Only do more work if there are still rows in this row group
+                if (row != groupEnd) {
+                    ValueType xi, yi;
+                    ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
+                    for (;row < groupEnd; ++row) {
+                        // Get the multiplication results
+                        multiplyRow(row, b[row], xSource, ySource, xi, yi);
+                        ValueType currentValue = xi + yi * getPrimaryBound<dir>();
+                        // Check if the current row is better then the previously found one
+                        if (better<dir>(currentValue, bestValue)) {
+                            xBest = std::move(xi);
+                            yBest = std::move(yi);
+                            bestValue = std::move(currentValue);
+                        } else if (currentValue == bestValue && yBest > yi) {
+                            // If the value for this row is not strictly better, it might still be equal and have a better y value
+                            xBest = std::move(xi);
+                            yBest = std::move(yi);
+                        }
+                    }
+                }
+                xResult = std::move(xBest);
+                yResult = std::move(yBest);
+            }
+            
+            template<typename ValueType>
+            template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+            void SoundValueIterationHelper<ValueType>::processRowGroupUpdateDecisionValue(uint64_t row, uint64_t groupEnd, std::vector<ValueType> const& b, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xResult, ValueType& yResult, std::vector<ValueType>& xTmp, std::vector<ValueType>& yTmp, bool& hasDecisionValue, ValueType& decisionValue) const {
+                // Perform the iteration for the first row in the group
+                ValueType xBest, yBest;
+                multiplyRow(row, b[row], xSource, ySource, xBest, yBest);
+                ++row;
+                // Only do more work if there are still rows in this row group
+                if (row != groupEnd) {
+                    ValueType xi, yi;
+                    uint64_t xyTmpIndex = 0;
+                    if (hasPrimaryBound<dir>()) {
+                        ValueType bestValue = xBest + yBest * getPrimaryBound<dir>();
+                        for (;row < groupEnd; ++row) {
+                            // Get the multiplication results
+                            multiplyRow(row, b[row], xSource, ySource, xi, yi);
+                            ValueType currentValue = xi + yi * getPrimaryBound<dir>();
+                            // Check if the current row is better then the previously found one
+                            if (better<dir>(currentValue, bestValue)) {
+                                if (yBest < yi) {
+                                    // We need to store the 'old' best value as it might be relevant for the decision value
+                                    xTmp[xyTmpIndex] = std::move(xBest);
+                                    yTmp[xyTmpIndex] = std::move(yBest);
+                                    ++xyTmpIndex;
                                 }
-                            }
-                        } else {
-                            for (;row < groupEnd; ++row) {
-                                multiplyRow(row, b[row], xi, yi);
-                                // Update the best choice
-                                if (yi > yBest || (yi == yBest && better<dir>(xi, xBest))) {
-                                        xTmp[xyTmpIndex] = std::move(xBest);
-                                        yTmp[xyTmpIndex] = std::move(yBest);
-                                        ++xyTmpIndex;
+                                xBest = std::move(xi);
+                                yBest = std::move(yi);
+                                bestValue = std::move(currentValue);
+                            } else if (yBest > yi) {
+                                // If the value for this row is not strictly better, it might still be equal and have a better y value
+                                if (currentValue == bestValue) {
                                     xBest = std::move(xi);
                                     yBest = std::move(yi);
                                 } else {
@@ -217,22 +235,136 @@ namespace storm {
                                 }
                             }
                         }
-                        
-                        // Update the decision value
-                        for (uint64_t i = 0; i < xyTmpIndex; ++i) {
-                            ValueType deltaY = yBest - yTmp[i];
-                            if (deltaY > storm::utility::zero<ValueType>()) {
-                                ValueType newDecisionValue = (xTmp[i] - xBest) / deltaY;
-                                if (!hasDecisionValue || better<dir>(newDecisionValue, decisionValue)) {
-                                    decisionValue = std::move(newDecisionValue);
-                                    STORM_LOG_TRACE("Update decision value to " << decisionValue);
-                                    hasDecisionValue = true;
-                                }
+                    } else {
+                        for (;row < groupEnd; ++row) {
+                            multiplyRow(row, b[row], xSource, ySource, xi, yi);
+                            // Update the best choice
+                            if (yi > yBest || (yi == yBest && better<dir>(xi, xBest))) {
+                                xTmp[xyTmpIndex] = std::move(xBest);
+                                yTmp[xyTmpIndex] = std::move(yBest);
+                                ++xyTmpIndex;
+                                xBest = std::move(xi);
+                                yBest = std::move(yi);
+                            } else {
+                                xTmp[xyTmpIndex] = std::move(xi);
+                                yTmp[xyTmpIndex] = std::move(yi);
+                                ++xyTmpIndex;
+                            }
+                        }
+                    }
+                    
+                    // Update the decision value
+                    for (uint64_t i = 0; i < xyTmpIndex; ++i) {
+                        ValueType deltaY = yBest - yTmp[i];
+                        if (deltaY > storm::utility::zero<ValueType>()) {
+                            ValueType newDecisionValue = (xTmp[i] - xBest) / deltaY;
+                            if (!hasDecisionValue || better<dir>(newDecisionValue, decisionValue)) {
+                                decisionValue = std::move(newDecisionValue);
+                                STORM_LOG_TRACE("Update decision value to " << decisionValue);
+                                hasDecisionValue = true;
                             }
                         }
                     }
-                    *xIt = std::move(xBest);
-                    *yIt = std::move(yBest);
+                }
+                xResult = std::move(xBest);
+                yResult = std::move(yBest);
+            }
+            
+            template<typename ValueType>
+            template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+            void SoundValueIterationHelper<ValueType>::performIterationStepParallel(std::vector<ValueType> const& b) {
+#ifdef STORM_HAVE_INTELTBB
+                // The row groups are updated concurrently (Jacobi style), so all of them read the values of the previous
+                // iteration. In the same pass, we collect the decision value and (in the second phase) the extremal
+                // values of x/(1-y) that the convergence check would otherwise compute in a separate pass.
+                x.swap(xPrevious);
+                y.swap(yPrevious);
+                x.resize(xPrevious.size());
+                y.resize(yPrevious.size());
+                
+                fusedBounds.hasBounds = false;
+                bool const updateDecisionValue = dir != InternalOptimizationDirection::None && !decisionValueBlocks;
+                bool const computeBounds = !convergencePhase1;
+                uint64_t const numberOfGroups = rowGroupIndices ? rowGroupIndices->size() - 1 : numRows;
+                uint64_t const largestGroup = xTmp.size();
+                
+                ParallelStepResult initial;
+                initial.hasDecisionValue = hasDecisionValue;
+                initial.decisionValue = decisionValue;
+                ParallelStepResult result = tbb::parallel_reduce(tbb::blocked_range<uint64_t>(0, numberOfGroups, 100), initial, [&] (tbb::blocked_range<uint64_t> const& range, ParallelStepResult partialResult) -> ParallelStepResult {
+                    std::vector<ValueType> localXTmp(updateDecisionValue ? largestGroup : 0), localYTmp(updateDecisionValue ? largestGroup : 0);
+                    for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                        if (dir == InternalOptimizationDirection::None) {
+                            multiplyRow(group, b[group], xPrevious, yPrevious, x[group], y[group]);
+                        } else if (updateDecisionValue) {
+                            processRowGroupUpdateDecisionValue<dir>((*rowGroupIndices)[group], (*rowGroupIndices)[group + 1], b, xPrevious, yPrevious, x[group], y[group], localXTmp, localYTmp, partialResult.hasDecisionValue, partialResult.decisionValue);
+                        } else {
+                            processRowGroup<dir>((*rowGroupIndices)[group], (*rowGroupIndices)[group + 1], b, xPrevious, yPrevious, x[group], y[group]);
+                        }
+                        if (computeBounds) {
+                            partialResult.includeBound(x[group] / (storm::utility::one<ValueType>() - y[group]), group);
+                        }
+                    }
+                    return partialResult;
+                }, [] (ParallelStepResult first, ParallelStepResult const& second) -> ParallelStepResult {
+                    first.template merge<dir>(second);
+                    return first;
+                });
+                
+                if (updateDecisionValue && result.hasDecisionValue && (!hasDecisionValue || better<dir>(result.decisionValue, decisionValue))) {
+                    STORM_LOG_TRACE("Update decision value to " << result.decisionValue);
+                    hasDecisionValue = true;
+                    decisionValue = std::move(result.decisionValue);
+                }
+                if (computeBounds && result.hasBounds) {
+                    fusedBounds = std::move(result);
+                }
+#else
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel sound value iteration requires Intel TBB.");
+#endif
+            }
+            
+            template<typename ValueType>
+            void SoundValueIterationHelper<ValueType>::ParallelStepResult::includeBound(ValueType const& bound, uint64_t index) {
+                if (!hasBounds) {
+                    hasBounds = true;
+                    minBound = bound;
+                    maxBound = bound;
+                    minIndex = index;
+                    maxIndex = index;
+                } else if (bound < minBound) {
+                    minBound = bound;
+                    minIndex = index;
+                } else if (bound > maxBound) {
+                    maxBound = bound;
+                    maxIndex = index;
+                }
+            }
+            
+            template<typename ValueType>
+            template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+            void SoundValueIterationHelper<ValueType>::ParallelStepResult::merge(ParallelStepResult const& other) {
+                if (other.hasDecisionValue && (!hasDecisionValue || (dir == InternalOptimizationDirection::Maximize ? other.decisionValue > decisionValue : other.decisionValue < decisionValue))) {
+                    hasDecisionValue = true;
+                    decisionValue = other.decisionValue;
+                }
+                if (other.hasBounds) {
+                    if (!hasBounds) {
+                        hasBounds = true;
+                        minBound = other.minBound;
+                        maxBound = other.maxBound;
+                        minIndex = other.minIndex;
+                        maxIndex = other.maxIndex;
+                    } else {
+                        if (other.minBound < minBound) {
+                            minBound = other.minBound;
+                            minIndex = other.minIndex;
+                        }
+                        if (other.maxBound > maxBound) {
+                            maxBound = other.maxBound;
+                            maxIndex = other.maxIndex;
+                        }
+                    }
                 }
             }
 
@@ -384,6 +516,39 @@ namespace storm {
             template<typename ValueType>
             template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
             void SoundValueIterationHelper<ValueType>::updateLowerUpperBound(ValueType& lowerBoundCandidate, ValueType& upperBoundCandidate) {
+                if (fusedBounds.hasBounds) {
+                    // The extremal values were already computed during the (parallel) iteration step.
+                    fusedBounds.hasBounds = false;
+                    if (dir != InternalOptimizationDirection::None && decisionValueBlocks) {
+                        ValueType const& currentBound = dir == InternalOptimizationDirection::Maximize ? fusedBounds.minBound : fusedBounds.maxBound;
+                        if (better<dir>(getSecondaryBound<dir>(), currentBound)) {
+                            getSecondaryIndex<dir>() = dir == InternalOptimizationDirection::Maximize ? fusedBounds.minIndex : fusedBounds.maxIndex;
+                            getSecondaryBound<dir>() = currentBound;
+                        }
+                    } else {
+                        if (fusedBounds.minBound < lowerBoundCandidate) {
+                            minIndex = fusedBounds.minIndex;
+                            lowerBoundCandidate = fusedBounds.minBound;
+                        }
+                        if (fusedBounds.maxBound > upperBoundCandidate) {
+                            maxIndex = fusedBounds.maxIndex;
+                            upperBoundCandidate = fusedBounds.maxBound;
+                        }
+                    }
+                } else {
+                    updateLowerUpperBoundCandidates<dir>(lowerBoundCandidate, upperBoundCandidate);
+                }
+                if ((dir != InternalOptimizationDirection::Minimize || !decisionValueBlocks) && (!hasLowerBound || lowerBoundCandidate > lowerBound)) {
+                    setLowerBound(lowerBoundCandidate);
+                }
+                if ((dir != InternalOptimizationDirection::Maximize || !decisionValueBlocks) && (!hasUpperBound || upperBoundCandidate < upperBound)) {
+                    setUpperBound(upperBoundCandidate);
+                }
+            }
+            
+            template<typename ValueType>
+            template<typename SoundValueIterationHelper<ValueType>::InternalOptimizationDirection dir>
+            void SoundValueIterationHelper<ValueType>::updateLowerUpperBoundCandidates(ValueType& lowerBoundCandidate, ValueType& upperBoundCandidate) {
                 auto xIt = x.begin();
                 auto xIte = x.end();
                 auto yIt = y.begin();
@@ -404,12 +569,6 @@ namespace storm {
                         }
                     }
                 }
-                if ((dir != InternalOptimizationDirection::Minimize || !decisionValueBlocks) && (!hasLowerBound || lowerBoundCandidate > lowerBound)) {
-                    setLowerBound(lowerBoundCandidate);
-                }
-                if ((dir != InternalOptimizationDirection::Maximize || !decisionValueBlocks) && (!hasUpperBound || upperBoundCandidate < upperBound)) {
-                    setUpperBound(upperBoundCandidate);
-                }
             }
             
             template<typename ValueType>
@@ -26,13 +26,15 @@ namespace storm {
                 
                 /*!
                  * Creates a new helper from the given data
+                 * @param jacobi If set and Intel TBB is enabled, the row groups of an iteration step are updated in parallel (Jacobi style).
                  */
-                SoundValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision);
+                SoundValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision, bool jacobi = false);
                 
                 /*!
                  * Creates a helper from the given data, considering the same matrix as the given old helper
+                 * @param jacobi If set and Intel TBB is enabled, the row groups of an iteration step are updated in parallel (Jacobi style).
                  */
-                SoundValueIterationHelper(SoundValueIterationHelper<ValueType>&& oldHelper, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision);
+                SoundValueIterationHelper(SoundValueIterationHelper<ValueType>&& oldHelper, std::vector<ValueType>& x, std::vector<ValueType>& y, bool relative, ValueType const& precision, bool jacobi = false);
                 
                 /*!
                  * Sets the currently known lower / upper bound
@@ -79,7 +81,24 @@ namespace storm {
                 template<InternalOptimizationDirection dir>
                 void performIterationStepUpdateDecisionValue(std::vector<ValueType> const& b);
                 
+                /*!
+                 * Performs one iteration step in which the row groups are processed in parallel. In contrast to the
+                 * sequential (Gauss-Seidel style) steps, all groups read the values of the previous iteration. The pass
+                 * also collects the decision value and the extremal values needed to update the bounds.
+                 */
+                template<InternalOptimizationDirection dir>
+                void performIterationStepParallel(std::vector<ValueType> const& b);
+                
+                template<InternalOptimizationDirection dir>
+                void processRowGroup(uint64_t row, uint64_t groupEnd, std::vector<ValueType> const& b, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xResult, ValueType& yResult) const;
+                
+                template<InternalOptimizationDirection dir>
+                void processRowGroupUpdateDecisionValue(uint64_t row, uint64_t groupEnd, std::vector<ValueType> const& b, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xResult, ValueType& yResult, std::vector<ValueType>& xTmp, std::vector<ValueType>& yTmp, bool& hasDecisionValue, ValueType& decisionValue) const;
+                
                 void multiplyRow(IndexType const& rowIndex, ValueType const& bi, ValueType& xi, ValueType& yi);
+                void multiplyRow(IndexType const& rowIndex, ValueType const& bi, std::vector<ValueType> const& xSource, std::vector<ValueType> const& ySource, ValueType& xi, ValueType& yi) const;
+                
+                static bool useParallelIterations(bool jacobi);
     
                 template<InternalOptimizationDirection dir>
                 bool checkConvergenceUpdateBounds(storm::storage::BitVector const* relevantValues = nullptr);
@@ -95,12 +114,15 @@ namespace storm {
                 template<InternalOptimizationDirection dir>
                 void updateLowerUpperBound(ValueType& lowerBoundCandidate, ValueType& upperBoundCandidate);
                 
+                template<InternalOptimizationDirection dir>
+                void updateLowerUpperBoundCandidates(ValueType& lowerBoundCandidate, ValueType& upperBoundCandidate);
+                
                 template<InternalOptimizationDirection dir>
                 void checkIfDecisionValueBlocks();
                 
                 // Auxiliary helper functions to avoid case distinctions due to different optimization directions
                 template<InternalOptimizationDirection dir>
-                inline bool better(ValueType const& val1, ValueType const& val2) {
+                inline bool better(ValueType const& val1, ValueType const& val2) const {
                     return (dir == InternalOptimizationDirection::Maximize) ? val1 > val2 : val1 < val2;
                 }
                 template<InternalOptimizationDirection dir>
@@ -108,10 +130,18 @@ namespace storm {
                     return (dir == InternalOptimizationDirection::Maximize) ? upperBound : lowerBound;
                 }
                 template<InternalOptimizationDirection dir>
+                inline ValueType const& getPrimaryBound() const {
+                    return (dir == InternalOptimizationDirection::Maximize) ? upperBound : lowerBound;
+                }
+                template<InternalOptimizationDirection dir>
                 inline bool& hasPrimaryBound() {
                     return (dir == InternalOptimizationDirection::Maximize) ? hasUpperBound : hasLowerBound;
                 }
                 template<InternalOptimizationDirection dir>
+                inline bool const& hasPrimaryBound() const {
+                    return (dir == InternalOptimizationDirection::Maximize) ? hasUpperBound : hasLowerBound;
+                }
+                template<InternalOptimizationDirection dir>
                 inline ValueType& getSecondaryBound() {
                     return (dir == InternalOptimizationDirection::Maximize) ? lowerBound : upperBound;
                 }
@@ -143,6 +173,26 @@ namespace storm {
                 std::vector<IndexType> matrixColumns;
                 std::vector<IndexType> rowIndications;
                 std::vector<uint_fast64_t> const* rowGroupIndices;
+                
+                // The results of a parallel iteration step that are combined over all row groups.
+                struct ParallelStepResult {
+                    void includeBound(ValueType const& bound, uint64_t index);
+                    template<InternalOptimizationDirection dir>
+                    void merge(ParallelStepResult const& other);
+                    
+                    bool hasBounds = false;
+                    ValueType minBound, maxBound;
+                    uint64_t minIndex = 0, maxIndex = 0;
+                    bool hasDecisionValue = false;
+                    ValueType decisionValue;
+                };
+                
+                // Whether the iteration steps are performed in parallel.
+                bool parallel;
+                // The values of the previous iteration (only used for parallel steps).
+                std::vector<ValueType> xPrevious, yPrevious;
+                // The extremal values of x/(1-y) computed during the last parallel iteration step (if any).
+                ParallelStepResult fusedBounds;
             };
             
         }
@@ -72,7 +72,7 @@ namespace storm {
         }
         
         template<class ValueType, class Hash>
-        void BitVectorHashMap<ValueType, Hash>::increaseSize() {
+        void BitVectorHashMap<ValueType, Hash>::increaseSize(std::vector<uint64_t>* bucketRemapping) {
             ++currentSize;
             STORM_LOG_TRACE("Increasing size of hash map from " << (1ull << (currentSize - 1)) << " to " << (1ull << currentSize) << ".");
             
@@ -87,8 +87,14 @@ namespace storm {
             // Now iterate through the elements and reinsert them in the new storage.
             uint64_t oldSize = numberOfElements;
             numberOfElements = 0;
+            if (bucketRemapping) {
+                bucketRemapping->assign(oldOccupied.size(), 0);
+            }
             for (auto bucketIndex : oldOccupied) {
-                findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+                uint64_t newBucket = findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]).second;
+                if (bucketRemapping) {
+                    (*bucketRemapping)[bucketIndex] = newBucket;
+                }
             }
             STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
         }
@@ -116,10 +122,17 @@ namespace storm {
         }
         
         template<class ValueType, class Hash>
-        bool BitVectorHashMap<ValueType, Hash>::checkIncreaseSize() {
+        std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value, std::vector<uint64_t>& bucketRemapping) {
+            bucketRemapping.clear();
+            checkIncreaseSize(&bucketRemapping);
+            return findOrAddAndGetBucket(key, value);
+        }
+        
+        template<class ValueType, class Hash>
+        bool BitVectorHashMap<ValueType, Hash>::checkIncreaseSize(std::vector<uint64_t>* bucketRemapping) {
             // If the load of the map is too high, we increase the size.
             if (numberOfElements >= loadFactor * (1ull << currentSize)) {
-                this->increaseSize();
+                this->increaseSize(bucketRemapping);
                 return true;
             }
             return false;
@@ -131,6 +144,13 @@ namespace storm {
             STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
             return values[flagBucketPair.second];
         }
+
+        template<class ValueType, class Hash>
+        uint64_t BitVectorHashMap<ValueType, Hash>::getBucket(storm::storage::BitVector const& key) const {
+            std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+            STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
+            return flagBucketPair.second;
+        }
         
         template<class ValueType, class Hash>
         ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
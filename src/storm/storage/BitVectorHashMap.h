@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 #include "storm/storage/BitVector.h"
 
@@ -85,6 +86,22 @@ namespace storm {
              * was inserted.
              */
             std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value. If the map has to be resized for this, the new bucket of every
+             * previously occupied bucket is stored in the given vector (at the index of the previous bucket), so that
+             * known buckets can be updated without searching for their keys again.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @param bucketRemapping Is set to the mapping from previous to new buckets if the map was resized and is
+             * cleared otherwise.
+             * @return A pair whose first component is the found value if the key is already contained in the map and
+             * the provided new value otherwise and whose second component is the index of the bucket into which the key
+             * was inserted.
+             */
+            std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value, std::vector<uint64_t>& bucketRemapping);
             
             /*!
              * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
@@ -108,6 +125,14 @@ namespace storm {
              * @return The value associated with the given bucket (if any).
              */
             ValueType getValue(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the index of the bucket in which the given key is stored. If the key does not exist, the
+             * behaviour is undefined. The bucket stays valid until the map is resized.
+             *
+             * @return The index of the bucket of the given key.
+             */
+            uint64_t getBucket(storm::storage::BitVector const& key) const;
             
             /*!
              * Checks if the given key is already contained in the map.
@@ -182,15 +207,19 @@ namespace storm {
             
             /*!
              * Increases the size of the hash map and performs the necessary rehashing of all entries.
+             *
+             * @param bucketRemapping If given, the new bucket of every previously occupied bucket is stored in this
+             * vector (at the index of the previous bucket).
              */
-            void increaseSize();
+            void increaseSize(std::vector<uint64_t>* bucketRemapping = nullptr);
             
             /*!
              * Checks whether the size should be increased and does so if necessary.
              *
+             * @param bucketRemapping If given and the size is increased, the mapping from previous to new buckets.
              * @return True iff the storage was increased.
              */
-            bool checkIncreaseSize();
+            bool checkIncreaseSize(std::vector<uint64_t>* bucketRemapping = nullptr);
 
             /*!
              * Determines the number of bits by which the hash value must be shifted to obtain a value in the legal range.
@@ -65,16 +65,22 @@ namespace storm {
             }
 
             void push(uint64_t const& item) {
+                STORM_LOG_ASSERT(!contains(item), "Element is already contained in the queue.");
+                // Insert the element at the back and sift it up (keeping track of the positions).
                 container.emplace_back(item);
-                std::push_heap(container.begin(), container.end(), compare);
+                positions[item] = container.size() - 1;
+                increase(item);
             }
             
             void pop() {
+                // Mark the popped element as not contained (its position is never smaller than the size of the queue).
+                T popped = container.front();
                 if (container.size() > 1) {
                     // Swap max element to back.
                     std::swap(positions[container.front()], positions[container.back()]);
                     std::swap(container.front(), container.back());
                     container.pop_back();
+                    positions[popped] = positions.size();
                     
                     // Sift down the element from the top.
                     uint64_t positionToSift = 0;
@@ -108,6 +114,7 @@ namespace storm {
                     
                 } else {
                     container.pop_back();
+                    positions[popped] = positions.size();
                 }
                 
                 STORM_LOG_ASSERT(std::is_heap(container.begin(), container.end(), compare), "Heap structure lost.");
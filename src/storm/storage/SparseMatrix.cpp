@@ -1718,6 +1718,51 @@ namespace storm {
         }
 #endif
         
+        /*!
+         * Applies the given update function to all elements of all colour classes. The colour classes are processed one
+         * after another, whereas the elements of one class are processed in parallel if TBB is available.
+         */
+        template<typename IndexType, typename UpdateFunction>
+        void performColoredSweep(std::vector<std::vector<IndexType>> const& coloring, UpdateFunction const& update) {
+            for (auto const& colorClass : coloring) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, colorClass.size(), 100), [&colorClass, &update] (tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        update(colorClass[index]);
+                    }
+                });
+#else
+                for (auto const& element : colorClass) {
+                    update(element);
+                }
+#endif
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<std::vector<index_type>> const& coloring) const {
+            performColoredSweep(coloring, [this, &omega, &x, &b] (index_type const& row) {
+                ValueType tmpValue = storm::utility::zero<ValueType>();
+                ValueType diagonalElement = storm::utility::zero<ValueType>();
+                for (auto const& entry : this->getRow(row)) {
+                    if (entry.getColumn() != row) {
+                        tmpValue += entry.getValue() * x[entry.getColumn()];
+                    } else {
+                        diagonalElement += entry.getValue();
+                    }
+                }
+                STORM_LOG_ASSERT(!storm::utility::isZero(diagonalElement), "Missing diagonal element in row " << row << ".");
+                x[row] = ((storm::utility::one<ValueType>() - omega) * x[row]) + (omega / diagonalElement) * (b[row] - tmpValue);
+            });
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<Interval>::performSuccessiveOverRelaxationStep(Interval, std::vector<Interval>&, std::vector<Interval> const&, std::vector<std::vector<index_type>> const&) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::performWalkerChaeStep(std::vector<ValueType> const& x, std::vector<ValueType> const& columnSums, std::vector<ValueType> const& b, std::vector<ValueType> const& ax, std::vector<ValueType>& result) const {
             const_iterator it = this->begin();
@@ -2043,6 +2088,49 @@ namespace storm {
 #endif
 #endif
         
+        template<typename ValueType>
+        std::vector<std::vector<typename SparseMatrix<ValueType>::index_type>> SparseMatrix<ValueType>::computeRowGroupColoring() const {
+            STORM_LOG_THROW(this->getRowGroupCount() == this->getColumnCount(), storm::exceptions::InvalidArgumentException, "Cannot colour the row groups of a matrix whose number of columns differs from the number of row groups.");
+            std::vector<index_type> const& groupIndices = this->getRowGroupIndices();
+            
+            // The transposed matrix (with joined groups) yields the groups that refer to a given group.
+            storm::storage::SparseMatrix<ValueType> transposed = this->transpose(true);
+            
+            std::vector<std::vector<index_type>> result;
+            std::vector<index_type> groupToColor(this->getRowGroupCount());
+            // For every colour, we store the last group for which it was forbidden. This way, we do not need to reset the
+            // forbidden colours for every group.
+            std::vector<index_type> colorForbiddenForGroup;
+            for (index_type group = 0; group < this->getRowGroupCount(); ++group) {
+                // Forbid the colours of all (already coloured) groups that the current group refers to or that refer to the current group.
+                for (auto const& entry : this->getRows(groupIndices[group], groupIndices[group + 1])) {
+                    if (entry.getColumn() < group) {
+                        colorForbiddenForGroup[groupToColor[entry.getColumn()]] = group;
+                    }
+                }
+                for (auto const& entry : transposed.getRow(group)) {
+                    if (entry.getColumn() < group) {
+                        colorForbiddenForGroup[groupToColor[entry.getColumn()]] = group;
+                    }
+                }
+                
+                // Pick the smallest colour that is not forbidden.
+                index_type color = 0;
+                while (color < result.size() && colorForbiddenForGroup[color] == group) {
+                    ++color;
+                }
+                if (color == result.size()) {
+                    result.emplace_back();
+                    colorForbiddenForGroup.push_back(this->getRowGroupCount());
+                }
+                groupToColor[group] = color;
+                result[color].push_back(group);
+            }
+            
+            STORM_LOG_TRACE("Coloured " << this->getRowGroupCount() << " row groups with " << result.size() << " colours.");
+            return result;
+        }
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             
@@ -921,6 +921,16 @@ namespace storm {
             template<typename Compare>
             void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
 #endif
+            
+            /*!
+             * Computes a colouring of the row groups such that no row of a group has an entry in the column of another
+             * group with the same colour. For matrices with one column per row group, the groups of one colour do not
+             * depend on each other and can therefore be updated concurrently in Gauss-Seidel-like sweeps. The colouring
+             * is computed greedily (in the order of the row groups) and is thus deterministic.
+             *
+             * @return For every colour, the indices of the row groups with this colour in ascending order.
+             */
+            std::vector<std::vector<index_type>> computeRowGroupColoring() const;
 
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
@@ -964,6 +974,17 @@ namespace storm {
              * @param b The 'right-hand side' of the problem.
              */
             void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            /*!
+             * Performs one step of the successive over-relaxation technique in which the rows are processed colour by
+             * colour (see computeRowGroupColoring). The rows of one colour are processed in parallel if TBB is available.
+             *
+             * @param omega The Omega parameter for SOR.
+             * @param x The current solution vector. The result will be written to the very same vector.
+             * @param b The 'right-hand side' of the problem.
+             * @param coloring The colouring of the rows.
+             */
+            void performSuccessiveOverRelaxationStep(ValueType omega, std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<std::vector<index_type>> const& coloring) const;
 
             /*!
              * Performs one step of the Walker-Chae technique.
@@ -59,6 +59,26 @@ namespace storm {
              */
             static Add<LibraryType, ValueType> fromVector(DdManager<LibraryType> const& ddManager, std::vector<ValueType> const& values, Odd const& odd, std::set<storm::expressions::Variable> const& metaVariables);
             
+            /*!
+             * Computes the sum of all given ADDs. If the library supports it (e.g. sylvan), independent additions are
+             * performed in parallel.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to sum up.
+             * @return The sum of the ADDs.
+             */
+            static Add<LibraryType, ValueType> sum(DdManager<LibraryType> const& ddManager, std::vector<Add<LibraryType, ValueType>> const& adds);
+            
+            /*!
+             * Computes the product of all given ADDs. If the library supports it (e.g. sylvan), independent
+             * multiplications are performed in parallel.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to multiply.
+             * @return The product of the ADDs.
+             */
+            static Add<LibraryType, ValueType> product(DdManager<LibraryType> const& ddManager, std::vector<Add<LibraryType, ValueType>> const& adds);
+            
             /*!
              * Retrieves whether the two DDs represent the same function.
              *
@@ -2,12 +2,16 @@
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/OutOfMemoryException.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -19,7 +23,12 @@ namespace storm {
     namespace dd {
         template<DdType LibraryType>
         DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()) {
-            // Intentionally left empty.
+            if (storm::settings::hasModule<storm::settings::modules::ResourceSettings>()) {
+                storm::settings::modules::ResourceSettings const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+                if (resourceSettings.isDdMemoryBudgetSet()) {
+                    memoryBudget = resourceSettings.getDdMemoryBudgetInMegabytes() * 1024ull * 1024ull;
+                }
+            }
         }
         
         template<DdType LibraryType>
@@ -485,6 +494,34 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        DdManagerStatistics DdManager<LibraryType>::getStatistics() const {
+            return internalDdManager.getStatistics();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::setMemoryBudget(boost::optional<uint64_t> const& budget) {
+            memoryBudget = budget;
+        }
+        
+        template<DdType LibraryType>
+        boost::optional<uint64_t> const& DdManager<LibraryType>::getMemoryBudget() const {
+            return memoryBudget;
+        }
+        
+        template<DdType LibraryType>
+        bool DdManager<LibraryType>::isMemoryBudgetExceeded() const {
+            return memoryBudget && internalDdManager.getMemoryInUse() > memoryBudget.get();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::checkMemoryBudget(std::string const& context) const {
+            if (memoryBudget) {
+                uint64_t memoryInUse = internalDdManager.getMemoryInUse();
+                STORM_LOG_THROW(memoryInUse <= memoryBudget.get(), storm::exceptions::OutOfMemoryException, "The DD library uses " << memoryInUse / 1024 / 1024 << "MB while " << context << ", which exceeds the memory budget of " << memoryBudget.get() / 1024 / 1024 << "MB (see --ddmembudget).");
+            }
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -8,6 +8,7 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/AddIterator.h"
@@ -321,6 +322,42 @@ namespace storm {
              * Performs a debug check if available.
              */
             void debugCheck() const;
+            
+            /*!
+             * Retrieves statistics about the node table, the garbage collection and the operation cache of the
+             * underlying DD library.
+             *
+             * @return The statistics.
+             */
+            DdManagerStatistics getStatistics() const;
+            
+            /*!
+             * Sets the memory budget of the DD library. If none is given, there is no budget.
+             *
+             * @param budget The budget in bytes.
+             */
+            void setMemoryBudget(boost::optional<uint64_t> const& budget);
+            
+            /*!
+             * Retrieves the memory budget of the DD library (if any).
+             *
+             * @return The budget in bytes.
+             */
+            boost::optional<uint64_t> const& getMemoryBudget() const;
+            
+            /*!
+             * Retrieves whether the DD library currently uses more memory than the budget allows.
+             *
+             * @return True iff a budget is set and exceeded.
+             */
+            bool isMemoryBudgetExceeded() const;
+            
+            /*!
+             * Aborts the computation with an OutOfMemoryException if the memory budget is exceeded.
+             *
+             * @param context A description of the computation that is currently performed.
+             */
+            void checkMemoryBudget(std::string const& context) const;
 
         private:
             /*!
@@ -385,6 +422,9 @@ namespace storm {
             
             // The manager responsible for the variables.
             std::shared_ptr<storm::expressions::ExpressionManager> manager;
+            
+            // The memory budget (in bytes) of the DD library (if any).
+            boost::optional<uint64_t> memoryBudget;
         };
     }
 }
@@ -0,0 +1,32 @@
+#include "storm/storage/dd/DdManagerStatistics.h"
+
+namespace storm {
+    namespace dd {
+        
+        std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics) {
+            out << "  * live nodes: " << statistics.liveNodes << std::endl;
+            out << "  * peak nodes: ";
+            if (statistics.peakNodes) {
+                out << statistics.peakNodes.get() << std::endl;
+            } else {
+                out << "n/a" << std::endl;
+            }
+            out << "  * unique table size: " << statistics.tableSize << std::endl;
+            out << "  * memory in use: " << statistics.memoryInUse / 1024 / 1024 << "MB" << std::endl;
+            out << "  * garbage collections: " << statistics.garbageCollections << " (" << statistics.garbageCollectionTimeInMilliseconds << "ms)" << std::endl;
+            out << "  * operation cache hit ratio: ";
+            if (statistics.cacheLookups && statistics.cacheHits) {
+                if (statistics.cacheLookups.get() > 0) {
+                    out << static_cast<double>(statistics.cacheHits.get()) / statistics.cacheLookups.get();
+                } else {
+                    out << "0";
+                }
+                out << " (" << statistics.cacheHits.get() << " hits in " << statistics.cacheLookups.get() << " lookups)";
+            } else {
+                out << "n/a";
+            }
+            return out;
+        }
+        
+    }
+}
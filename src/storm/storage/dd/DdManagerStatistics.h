@@ -0,0 +1,44 @@
+#ifndef STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_
+#define STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_
+
+#include <cstdint>
+#include <ostream>
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace dd {
+        
+        /*!
+         * Statistics about the node table, the garbage collection and the operation cache of a DD manager.
+         */
+        struct DdManagerStatistics {
+            // The number of nodes currently stored in the unique table. For libraries that do not keep track of dead
+            // nodes, this includes the nodes that have not yet been collected.
+            uint64_t liveNodes = 0;
+            
+            // The largest number of nodes that was stored in the unique table at any point (if known).
+            boost::optional<uint64_t> peakNodes;
+            
+            // The number of slots of the unique table.
+            uint64_t tableSize = 0;
+            
+            // The memory (in bytes) occupied by the nodes (and, if the library reports it, the other tables).
+            uint64_t memoryInUse = 0;
+            
+            // The number of garbage collections performed so far.
+            uint64_t garbageCollections = 0;
+            
+            // The time (in milliseconds) spent in garbage collections so far.
+            uint64_t garbageCollectionTimeInMilliseconds = 0;
+            
+            // The number of lookups in and hits of the operation cache (if the library collects them).
+            boost::optional<uint64_t> cacheLookups;
+            boost::optional<uint64_t> cacheHits;
+        };
+        
+        std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics);
+        
+    }
+}
+
+#endif /* STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_ */
@@ -0,0 +1,29 @@
+#include "storm/storage/dd/OddTraversal.h"
+
+#include "storm/storage/dd/Odd.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace storm {
+    namespace dd {
+        namespace detail {
+            
+            // Below this number of explicit entries, spawning tasks does not pay off.
+            static const uint_fast64_t MINIMAL_NUMBER_OF_ENTRIES_FOR_PARALLEL_TRAVERSAL = 4096;
+            
+            // Splitting the topmost levels yields up to 2^levels tasks, which is plenty for load balancing.
+            static const uint_fast64_t NUMBER_OF_PARALLEL_TRAVERSAL_LEVELS = 6;
+            
+            uint_fast64_t getNumberOfParallelTraversalLevels(Odd const& odd) {
+#ifdef STORM_HAVE_INTELTBB
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && odd.getTotalOffset() >= MINIMAL_NUMBER_OF_ENTRIES_FOR_PARALLEL_TRAVERSAL) {
+                    return NUMBER_OF_PARALLEL_TRAVERSAL_LEVELS;
+                }
+#endif
+                return 0;
+            }
+            
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef STORM_STORAGE_DD_ODDTRAVERSAL_H_
+#define STORM_STORAGE_DD_ODDTRAVERSAL_H_
+
+#include <cstdint>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+namespace storm {
+    namespace dd {
+        class Odd;
+        
+        namespace detail {
+            
+            /*!
+             * Determines on how many of the topmost levels the ODD-guided translation of a DD to explicit vectors or
+             * matrices may descend into the else- and then-successors in parallel. Since the two successors of an ODD
+             * node cover disjoint offsets, the explicit entries they produce never overlap.
+             *
+             * @param odd The ODD guiding the translation (the row ODD in case of matrices).
+             * @return The number of levels, which is zero if the translation is to be performed sequentially.
+             */
+            uint_fast64_t getNumberOfParallelTraversalLevels(Odd const& odd);
+            
+            /*!
+             * Invokes the functions descending into the else- and then-successor, respectively. If requested (and
+             * supported), the two functions are executed concurrently.
+             *
+             * @param parallel A flag indicating whether the functions may be executed concurrently.
+             * @param elseFunction The function descending into the else-successor.
+             * @param thenFunction The function descending into the then-successor.
+             */
+            template<typename ElseFunction, typename ThenFunction>
+            void invokeTraversal(bool parallel, ElseFunction const& elseFunction, ThenFunction const& thenFunction) {
+#ifdef STORM_HAVE_INTELTBB
+                if (parallel) {
+                    tbb::parallel_invoke(elseFunction, thenFunction);
+                    return;
+                }
+#endif
+                elseFunction();
+                thenFunction();
+            }
+            
+        }
+    }
+}
+
+#endif /* STORM_STORAGE_DD_ODDTRAVERSAL_H_ */
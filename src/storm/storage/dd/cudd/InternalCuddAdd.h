@@ -645,6 +645,26 @@ namespace storm {
              */
             static InternalAdd<DdType::CUDD, ValueType> fromVector(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
             
+            /*!
+             * Computes the sum of all given ADDs. The additions are arranged in a balanced tree to keep the
+             * intermediate results small.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to sum up.
+             * @return The sum of the given ADDs.
+             */
+            static InternalAdd<DdType::CUDD, ValueType> sum(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<InternalAdd<DdType::CUDD, ValueType>> const& adds);
+            
+            /*!
+             * Computes the product of all given ADDs. The multiplications are arranged in a balanced tree to keep the
+             * intermediate results small.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to multiply.
+             * @return The product of the given ADDs.
+             */
+            static InternalAdd<DdType::CUDD, ValueType> product(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<InternalAdd<DdType::CUDD, ValueType>> const& adds);
+            
             /*!
              * Creates an ODD based on the current ADD.
              *
@@ -685,8 +705,10 @@ namespace storm {
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param function The callback invoked for every element. The first argument is the offset and the second
              * is the value.
+             * @param parallelLevels The number of topmost levels on which the successors may be traversed in parallel.
+             * If non-zero, the callback must be safe to invoke concurrently for distinct offsets.
              */
-            void forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const;
+            void forEachRec(DdNode const* dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function, uint_fast64_t parallelLevels) const;
             
             /*!
              * Splits the given matrix DD into the groups using the given group variables.
@@ -763,8 +785,10 @@ namespace storm {
              * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
              * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
              * this flag needs to be false.
+             * @param parallelLevels The number of topmost row levels on which the row successors may be traversed in
+             * parallel.
              */
-            void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+            void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, uint_fast64_t parallelLevels) const;
             
             /*!
              * Builds an ADD representing the given vector.
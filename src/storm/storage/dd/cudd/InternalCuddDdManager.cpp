@@ -157,6 +157,25 @@ namespace storm {
             this->getCuddManager().DebugCheck();
         }
         
+        DdManagerStatistics InternalDdManager<DdType::CUDD>::getStatistics() const {
+            ::DdManager* manager = this->getCuddManager().getManager();
+            
+            DdManagerStatistics result;
+            result.liveNodes = Cudd_ReadNodeCount(manager);
+            result.peakNodes = Cudd_ReadPeakNodeCount(manager);
+            result.tableSize = Cudd_ReadSlots(manager);
+            result.memoryInUse = Cudd_ReadMemoryInUse(manager);
+            result.garbageCollections = Cudd_ReadGarbageCollections(manager);
+            result.garbageCollectionTimeInMilliseconds = Cudd_ReadGarbageCollectionTime(manager);
+            result.cacheLookups = static_cast<uint64_t>(Cudd_ReadCacheLookUps(manager));
+            result.cacheHits = static_cast<uint64_t>(Cudd_ReadCacheHits(manager));
+            return result;
+        }
+        
+        uint64_t InternalDdManager<DdType::CUDD>::getMemoryInUse() const {
+            return Cudd_ReadMemoryInUse(this->getCuddManager().getManager());
+        }
+        
         cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
             return cuddManager;
         }
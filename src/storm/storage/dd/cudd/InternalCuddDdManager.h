@@ -5,6 +5,7 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
@@ -131,6 +132,21 @@ namespace storm {
              */
             void debugCheck() const;
             
+            /*!
+             * Retrieves statistics about the node table, the garbage collection and the operation cache.
+             *
+             * @return The statistics.
+             */
+            DdManagerStatistics getStatistics() const;
+            
+            /*!
+             * Retrieves the memory (in bytes) currently used by the DD library. This is meant to be cheap enough to
+             * be called regularly, e.g. to check a memory budget.
+             *
+             * @return The memory in use.
+             */
+            uint64_t getMemoryInUse() const;
+            
             /*!
              * Retrieves the number of DD variables managed by this manager.
              *
@@ -3,6 +3,7 @@
 #include "storm/storage/dd/sylvan/SylvanAddIterator.h"
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/OddTraversal.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
@@ -17,6 +18,38 @@
 
 namespace storm {
     namespace dd {
+        
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#endif
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+        
+        /*!
+         * Combines the given MTBDDs with the given operation. The two halves of the list are combined by separate
+         * tasks, so that independent operations can be stolen by other workers.
+         */
+        TASK_3(MTBDD, storm_mtbdd_apply_balanced, MTBDD*, dds, size_t, count, mtbdd_apply_op, op)
+        {
+            if (count == 1) {
+                return dds[0];
+            }
+            
+            size_t half = count / 2;
+            mtbdd_refs_spawn(SPAWN(storm_mtbdd_apply_balanced, dds, half, op));
+            MTBDD second = mtbdd_refs_push(CALL(storm_mtbdd_apply_balanced, dds + half, count - half, op));
+            MTBDD first = mtbdd_refs_push(mtbdd_refs_sync(SYNC(storm_mtbdd_apply_balanced)));
+            MTBDD result = mtbdd_apply(first, second, op);
+            mtbdd_refs_pop(2);
+            return result;
+        }
+        
+#pragma GCC diagnostic pop
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+        
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType>::InternalAdd() : ddManager(nullptr), sylvanMtbdd() {
             // Intentionally left empty.
@@ -902,7 +935,9 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::composeWithExplicitVector(storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::vector<ValueType>& targetVector, std::function<ValueType (ValueType const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); });
+            // Distinct offsets refer to distinct entries of the target vector, so the traversal may be parallelized.
+            uint_fast64_t parallelLevels = std::is_arithmetic<ValueType>::value ? storm::dd::detail::getNumberOfParallelTraversalLevels(odd) : 0;
+            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, [&function, &targetVector] (uint64_t const& offset, ValueType const& value) { targetVector[offset] = function(targetVector[offset], value); }, parallelLevels);
         }
 
         template<typename ValueType>
@@ -910,16 +945,16 @@ namespace storm {
             forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices,  [&function, &targetVector, &offsets] (uint64_t const& offset, ValueType const& value) {
                 ValueType& targetValue = targetVector[offsets[offset]];
                 targetValue = function(targetValue, value);
-            });
+            }, 0);
         }
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::forEach(Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
-            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function);
+            forEachRec(this->getSylvanMtbdd().GetMTBDD(), 0, ddVariableIndices.size(), 0, odd, ddVariableIndices, function, 0);
         }
 
         template<typename ValueType>
-        void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const {
+        void InternalAdd<DdType::Sylvan, ValueType>::forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function, uint_fast64_t parallelLevels) const {
             // For the empty DD, we do not need to add any entries.
             if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
                 return;
@@ -931,15 +966,17 @@ namespace storm {
             } else if (mtbdd_isleaf(dd) || ddVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
                 // If we skipped a level, we need to enumerate the explicit entries for the case in which the bit is set
                 // and for the one in which it is not set.
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                storm::dd::detail::invokeTraversal(currentLevel < parallelLevels,
+                    [&] { forEachRec(dd, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, parallelLevels); },
+                    [&] { forEachRec(dd, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function, parallelLevels); });
             } else {
                 // Otherwise, we simply recursively call the function for both (different) cases.
                 MTBDD thenNode = mtbdd_gethigh(dd);
                 MTBDD elseNode = mtbdd_getlow(dd);
 
-                forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function);
-                forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function);
+                storm::dd::detail::invokeTraversal(currentLevel < parallelLevels,
+                    [&] { forEachRec(elseNode, currentLevel + 1, maxLevel, currentOffset, odd.getElseSuccessor(), ddVariableIndices, function, parallelLevels); },
+                    [&] { forEachRec(thenNode, currentLevel + 1, maxLevel, currentOffset + odd.getElseOffset(), odd.getThenSuccessor(), ddVariableIndices, function, parallelLevels); });
             }
         }
 
@@ -1135,11 +1172,13 @@ namespace storm {
 
         template<typename ValueType>
         void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+            // Distinct rows only touch distinct entries of the given vectors, so the traversal may be parallelized over the rows.
+            uint_fast64_t parallelLevels = std::is_arithmetic<ValueType>::value ? storm::dd::detail::getNumberOfParallelTraversalLevels(rowOdd) : 0;
+            return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, parallelLevels);
         }
 
         template<typename ValueType>
-        void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+        void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues, uint_fast64_t parallelLevels) const {
             // For the empty DD, we do not need to add any entries.
             if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
                 return;
@@ -1180,14 +1219,18 @@ namespace storm {
                     }
                 }
 
-                // Visit else-else.
-                toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit else-then.
-                toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit then-else.
-                toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-                // Visit then-then.
-                toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+                // The else- and then-rows are disjoint, but within a row, the columns need to be visited in order.
+                storm::dd::detail::invokeTraversal(currentRowLevel < parallelLevels, [&] {
+                    // Visit else-else.
+                    toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, parallelLevels);
+                    // Visit else-then.
+                    toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, parallelLevels);
+                }, [&] {
+                    // Visit then-else.
+                    toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, parallelLevels);
+                    // Visit then-then.
+                    toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues, parallelLevels);
+                });
             }
         }
 
@@ -1197,6 +1240,74 @@ namespace storm {
             return InternalAdd<DdType::Sylvan, ValueType>(ddManager, sylvan::Mtbdd(fromVectorRec(offset, 0, ddVariableIndices.size(), values, odd, ddVariableIndices)));
         }
 
+        template<typename ValueType>
+        InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::applyBalanced(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds, mtbdd_apply_op op) {
+            STORM_LOG_ASSERT(!adds.empty(), "Expected at least one ADD.");
+            
+            // The MTBDDs are protected by the sylvan objects in the given ADDs, so it is safe to only pass the raw nodes.
+            std::vector<MTBDD> dds;
+            dds.reserve(adds.size());
+            for (auto const& add : adds) {
+                dds.push_back(add.getSylvanMtbdd().GetMTBDD());
+            }
+            
+            LACE_ME;
+            MTBDD result = CALL(storm_mtbdd_apply_balanced, dds.data(), dds.size(), op);
+            return InternalAdd<DdType::Sylvan, ValueType>(ddManager, sylvan::Mtbdd(result));
+        }
+        
+        template<typename ValueType>
+        InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<ValueType>();
+            }
+            return applyBalanced(ddManager, adds, TASK(mtbdd_op_plus));
+        }
+        
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, storm::RationalNumber>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalNumber>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<storm::RationalNumber>();
+            }
+            return applyBalanced(ddManager, adds, TASK(sylvan_storm_rational_number_op_plus));
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalAdd<DdType::Sylvan, storm::RationalFunction>::sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalFunction>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddZero<storm::RationalFunction>();
+            }
+            return applyBalanced(ddManager, adds, TASK(sylvan_storm_rational_function_op_plus));
+        }
+#endif
+        
+        template<typename ValueType>
+        InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::product(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddOne<ValueType>();
+            }
+            return applyBalanced(ddManager, adds, TASK(mtbdd_op_times));
+        }
+        
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalNumber> InternalAdd<DdType::Sylvan, storm::RationalNumber>::product(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalNumber>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddOne<storm::RationalNumber>();
+            }
+            return applyBalanced(ddManager, adds, TASK(sylvan_storm_rational_number_op_times));
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        InternalAdd<DdType::Sylvan, storm::RationalFunction> InternalAdd<DdType::Sylvan, storm::RationalFunction>::product(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, storm::RationalFunction>> const& adds) {
+            if (adds.empty()) {
+                return ddManager->template getAddOne<storm::RationalFunction>();
+            }
+            return applyBalanced(ddManager, adds, TASK(sylvan_storm_rational_function_op_times));
+        }
+#endif
+
         template<typename ValueType>
         MTBDD InternalAdd<DdType::Sylvan, ValueType>::fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
             if (currentLevel == maxLevel) {
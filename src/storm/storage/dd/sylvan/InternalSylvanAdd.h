@@ -637,6 +637,26 @@ namespace storm {
              */
             static InternalAdd<DdType::Sylvan, ValueType> fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
             
+            /*!
+             * Computes the sum of all given ADDs. The additions are arranged in a balanced tree whose independent
+             * subtrees are spawned as Lace tasks and can therefore be processed by all sylvan worker threads.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to sum up.
+             * @return The sum of the given ADDs.
+             */
+            static InternalAdd<DdType::Sylvan, ValueType> sum(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds);
+            
+            /*!
+             * Computes the product of all given ADDs. The multiplications are arranged in a balanced tree whose
+             * independent subtrees are spawned as Lace tasks and can therefore be processed by all sylvan worker threads.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The ADDs to multiply.
+             * @return The product of the given ADDs.
+             */
+            static InternalAdd<DdType::Sylvan, ValueType> product(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds);
+            
             /*!
              * Creates an ODD based on the current ADD.
              *
@@ -687,8 +707,10 @@ namespace storm {
              * @param ddVariableIndices The (sorted) indices of all DD variables that need to be considered.
              * @param function The callback invoked for every element. The first argument is the offset and the second
              * is the value.
+             * @param parallelLevels The number of topmost levels on which the successors may be traversed in parallel.
+             * If non-zero, the callback must be safe to invoke concurrently for distinct offsets.
              */
-            void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function) const;
+            void forEachRec(MTBDD dd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentOffset, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices, std::function<void (uint64_t const&, ValueType const&)> const& function, uint_fast64_t parallelLevels) const;
             
             /*!
              * Splits the given matrix DD into the labelings of the gropus using the given group variables.
@@ -755,6 +777,16 @@ namespace storm {
              */
             static MTBDD fromVectorRec(uint_fast64_t& currentOffset, uint_fast64_t currentLevel, uint_fast64_t maxLevel, std::vector<ValueType> const& values, Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices);
 
+            /*!
+             * Combines the given ADDs with the given binary operation in a balanced tree of (parallel) Lace tasks.
+             *
+             * @param ddManager The manager responsible for the ADDs.
+             * @param adds The (non-empty) list of ADDs to combine.
+             * @param op The (associative) sylvan operation to apply.
+             * @return The combined ADD.
+             */
+            static InternalAdd<DdType::Sylvan, ValueType> applyBalanced(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<InternalAdd<DdType::Sylvan, ValueType>> const& adds, mtbdd_apply_op op);
+
             /*!
              * Helper function to convert the DD into a (sparse) matrix.
              *
@@ -780,8 +812,10 @@ namespace storm {
              * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
              * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
              * this flag needs to be false.
+             * @param parallelLevels The number of topmost row levels on which the row successors may be traversed in
+             * parallel.
              */
-            void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+            void toMatrixComponentsRec(MTBDD dd, bool negated, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues, uint_fast64_t parallelLevels) const;
             
             /*!
              * Retrieves the sylvan representation of the given double value.
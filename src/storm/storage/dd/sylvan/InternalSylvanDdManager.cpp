@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -18,7 +20,24 @@
 namespace storm {
     namespace dd {
         
-#ifndef NDEBUG
+        // Statistics about the garbage collections. As sylvan is initialized only once, they are shared by all
+        // managers.
+        static uint64_t numberOfGarbageCollections = 0;
+        static std::chrono::high_resolution_clock::duration garbageCollectionTime(0);
+        static std::chrono::high_resolution_clock::time_point garbageCollectionStart;
+        
+        // Sylvan does not keep track of dead nodes, so we take the nodes surviving a garbage collection (or found in
+        // the table when counting them) as the live nodes.
+        static uint64_t liveNodeCount = 0;
+        static uint64_t peakNodeCount = 0;
+        static std::chrono::steady_clock::time_point lastNodeCountTime;
+        
+        // Counting the nodes requires a pass over the table, so we do not count more often than this.
+        static const std::chrono::milliseconds nodeCountInterval(1000);
+        
+        // The number of bytes a node occupies in the table (the node itself and its hash).
+        static const uint64_t bytesPerNode = 24;
+        
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wzero-length-array"
@@ -27,16 +46,23 @@ namespace storm {
         
         VOID_TASK_0(gc_start) {
             STORM_LOG_TRACE("Starting sylvan garbage collection...");
+            garbageCollectionStart = std::chrono::high_resolution_clock::now();
         }
         
         VOID_TASK_0(gc_end) {
-            STORM_LOG_TRACE("Sylvan garbage collection done.");
+            garbageCollectionTime += std::chrono::high_resolution_clock::now() - garbageCollectionStart;
+            ++numberOfGarbageCollections;
+            
+            size_t filled;
+            sylvan_table_usage(&filled, NULL);
+            liveNodeCount = filled;
+            peakNodeCount = std::max<uint64_t>(peakNodeCount, liveNodeCount);
+            lastNodeCountTime = std::chrono::steady_clock::now();
+            STORM_LOG_TRACE("Sylvan garbage collection done, " << liveNodeCount << " nodes survived.");
         }
         
 #if defined(__clang__)
 #pragma clang diagnostic pop
-#endif
-        
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -103,10 +129,8 @@ namespace storm {
                 sylvan::Sylvan::initMtbdd();
                 sylvan::Sylvan::initCustomMtbdd();
                 
-#ifndef NDEBUG
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
 
             }
             ++numberOfInstances;
@@ -259,6 +283,50 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
         
+        DdManagerStatistics InternalDdManager<DdType::Sylvan>::getStatistics() const {
+            LACE_ME;
+            size_t filled;
+            size_t total;
+            sylvan_table_usage(&filled, &total);
+            liveNodeCount = filled;
+            peakNodeCount = std::max<uint64_t>(peakNodeCount, liveNodeCount);
+            lastNodeCountTime = std::chrono::steady_clock::now();
+            
+            DdManagerStatistics result;
+            result.liveNodes = liveNodeCount;
+            result.peakNodes = peakNodeCount;
+            result.tableSize = total;
+            result.memoryInUse = liveNodeCount * bytesPerNode;
+            result.garbageCollections = numberOfGarbageCollections;
+            result.garbageCollectionTimeInMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(garbageCollectionTime).count();
+#if SYLVAN_STATS
+            // The statistics of the operation cache are only collected if sylvan was built with them.
+            sylvan_stats_t stats;
+            sylvan_stats_snapshot(&stats);
+            uint64_t lookups = 0;
+            uint64_t hits = 0;
+            for (int counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+                lookups += stats.counters[counter];
+                hits += stats.counters[counter + 2];
+            }
+            result.cacheLookups = lookups;
+            result.cacheHits = hits;
+#endif
+            return result;
+        }
+        
+        uint64_t InternalDdManager<DdType::Sylvan>::getMemoryInUse() const {
+            if (std::chrono::steady_clock::now() - lastNodeCountTime >= nodeCountInterval) {
+                LACE_ME;
+                size_t filled;
+                sylvan_table_usage(&filled, NULL);
+                liveNodeCount = filled;
+                peakNodeCount = std::max<uint64_t>(peakNodeCount, liveNodeCount);
+                lastNodeCountTime = std::chrono::steady_clock::now();
+            }
+            return liveNodeCount * bytesPerNode;
+        }
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
             return nextFreeVariableIndex;
         }
@@ -877,6 +877,66 @@ namespace storm {
                 return true;
             }
             
+            /*!
+             * Computes the difference of the given elements that equalModuloPrecision compares against the precision, i.e. the
+             * elements are equal modulo a precision iff the difference does not exceed it. If the elements are not equal modulo
+             * any precision (in relative terms, this happens if exactly one of them is zero), infinity is returned.
+             *
+             * @param val1 The first value to compare.
+             * @param val2 The second value to compare.
+             * @param relativeError If set, the difference is computed relative to the first value.
+             * @return The (non-negative) difference of the elements.
+             */
+            template<class T>
+            T differenceModuloPrecision(T const& val1, T const& val2, bool relativeError = true) {
+                if (relativeError) {
+                    if (storm::utility::isZero<T>(val1)) {
+                        return storm::utility::isZero(val2) ? storm::utility::zero<T>() : storm::utility::infinity<T>();
+                    }
+                    return storm::utility::abs<T>((val1 - val2) / val1);
+                } else {
+                    return storm::utility::abs<T>(val1 - val2);
+                }
+            }
+            
+            // Specializiation for double that is consistent with the one of equalModuloPrecision.
+            template<>
+            inline double differenceModuloPrecision(double const& val1, double const& val2, bool relativeError) {
+                if (relativeError) {
+                    if (storm::utility::isAlmostZero(val2)) {
+                        return storm::utility::isAlmostZero(val1) ? 0.0 : storm::utility::infinity<double>();
+                    }
+                    return storm::utility::abs((val1 - val2) / val1);
+                } else {
+                    return storm::utility::abs(val1 - val2);
+                }
+            }
+            
+            /*!
+             * Computes the largest difference (as computed by differenceModuloPrecision) between the entries of the given
+             * vectors. The vectors are equal modulo a precision iff this difference does not exceed it.
+             *
+             * @param vectorLeft The first vector of the comparison.
+             * @param vectorRight The second vector of the comparison.
+             * @param relativeError If set, the difference between the vectors is computed relative to the value or in absolute terms.
+             */
+            template<class T>
+            T maximalDifferenceModuloPrecision(std::vector<T> const& vectorLeft, std::vector<T> const& vectorRight, bool relativeError) {
+                STORM_LOG_ASSERT(vectorLeft.size() == vectorRight.size(), "Lengths of vectors does not match.");
+                
+                T result = storm::utility::zero<T>();
+                auto leftIt = vectorLeft.begin();
+                auto leftIte = vectorLeft.end();
+                auto rightIt = vectorRight.begin();
+                for (; leftIt != leftIte; ++leftIt, ++rightIt) {
+                    T difference = differenceModuloPrecision(*leftIt, *rightIt, relativeError);
+                    if (difference > result) {
+                        result = std::move(difference);
+                    }
+                }
+                return result;
+            }
+            
             /*!
              * Compares the two vectors and determines whether they are equal modulo the provided precision. Depending on whether the
              * flag is set, the difference between the vectors is computed relative to the value or in absolute terms.
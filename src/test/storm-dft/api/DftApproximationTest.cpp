@@ -61,13 +61,13 @@ namespace {
             return boost::get<storm::modelchecker::DFTModelChecker<double>::approximation_result>(results[0]);
         }
 
-        std::pair<double, double> analyzeTimebound(std::string const& file, double timeBound, double errorBound) {
+        std::pair<double, double> analyzeTimebound(std::string const& file, double timeBound, double errorBound, bool allowModularisation = false) {
             std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(file);
             EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
             std::stringstream propertyStream;
             propertyStream << "P=? [F<=" << timeBound << " \"failed\"]";
             std::vector <std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()));
-            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, false, storm::utility::RelevantEvents(), errorBound, config.heuristic, false);
+            typename storm::modelchecker::DFTModelChecker<double>::dft_results results = storm::api::analyzeDFT<double>(*dft, properties, config.useSR, allowModularisation, storm::utility::RelevantEvents(), errorBound, config.heuristic, false);
             return boost::get<storm::modelchecker::DFTModelChecker<double>::approximation_result>(results[0]);
         }
 
@@ -105,4 +105,14 @@ namespace {
         EXPECT_GE(approxResult.second - approxResult.first, errorBound / 10);
     }
 
+    TYPED_TEST(DftApproximationTest, HecsTimeboundModularisation) {
+        double errorBound = 0.1;
+        double timeBound = 100;
+        // Each module is approximated on its own
+        std::pair<double, double> approxResult = this->analyzeTimebound(STORM_TEST_RESOURCES_DIR "/dft/hecs_3_2_2_np.dft", timeBound, errorBound, true);
+        EXPECT_LE(approxResult.first, 0.0410018417);
+        EXPECT_GE(approxResult.second, 0.0410018417);
+        EXPECT_LE(approxResult.second - approxResult.first, errorBound);
+    }
+
 }
@@ -3,7 +3,13 @@
 
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
+#include "storm-dft/settings/modules/FaultTreeSettings.h"
 #include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 namespace {
 
@@ -90,4 +96,50 @@ namespace {
         EXPECT_EQ(13ul, model->getNumberOfTransitions());
     }
 
+    TEST(DftModelBuildingTest, ParallelExploration) {
+        std::string property = "Tmin=? [F \"failed\"]";
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+        storm::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+        auto& ftSettings = dynamic_cast<storm::settings::modules::FaultTreeSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::FaultTreeSettings::moduleName));
+
+        for (std::string const& file : {"/dft/hecs_3_2_2_np.dft", "/dft/spare5.dft", "/dft/pdep4.dft", "/dft/seq6.dft"}) {
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR + file);
+            EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+
+            // Build the model sequentially
+            std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel;
+            {
+                std::unique_ptr<storm::settings::SettingMemento> sequential = ftSettings.overrideParallelExplorationSet(false);
+                storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+                builder.buildModel(0, 0.0);
+                sequentialModel = builder.getModel();
+            }
+
+            // Build the model in batches (of the default batch size)
+            std::shared_ptr<storm::models::sparse::Model<double>> parallelModel;
+            {
+                std::unique_ptr<storm::settings::SettingMemento> parallel = ftSettings.overrideParallelExplorationSet(true);
+                std::unique_ptr<storm::settings::SettingMemento> enableTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+                EXPECT_GT(ftSettings.getParallelExplorationBatchSize(), 1ul);
+                storm::builder::ExplicitDFTModelBuilder<double> builder(*dft, symmetries);
+                builder.buildModel(0, 0.0);
+                parallelModel = builder.getModel();
+            }
+
+            EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates()) << file;
+            EXPECT_EQ(sequentialModel->getNumberOfTransitions(), parallelModel->getNumberOfTransitions()) << file;
+            EXPECT_EQ(sequentialModel->getType(), parallelModel->getType()) << file;
+
+            auto task = storm::api::createTask<double>(properties[0], true);
+            auto sequentialResult = storm::api::verifyWithSparseEngine<double>(sequentialModel, task);
+            auto parallelResult = storm::api::verifyWithSparseEngine<double>(parallelModel, task);
+            ASSERT_TRUE(sequentialResult);
+            ASSERT_TRUE(parallelResult);
+            double sequentialValue = sequentialResult->asExplicitQuantitativeCheckResult<double>()[*sequentialModel->getInitialStates().begin()];
+            double parallelValue = parallelResult->asExplicitQuantitativeCheckResult<double>()[*parallelModel->getInitialStates().begin()];
+            EXPECT_NEAR(sequentialValue, parallelValue, 1e-6) << file;
+        }
+    }
+
 }
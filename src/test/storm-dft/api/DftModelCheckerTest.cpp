@@ -248,4 +248,26 @@ namespace {
         double result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", 1.0);
         EXPECT_FLOAT_EQ(result, 0.00021997582);
     }
+
+    TEST(DftModelCheckerTest, ModularisationThreads) {
+        std::string property = "Pmin=? [F<=1 \"failed\"]";
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        for (std::string const& file : {"/dft/hecs_2_2.dft", "/dft/spare_two_modules.dft", "/dft/voting2.dft", "/dft/voting4.dft", "/dft/mutex.dft"}) {
+            std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR + file);
+            EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+            storm::utility::RelevantEvents relevantEvents = storm::api::computeRelevantEvents<double>(*dft, properties, {}, false);
+
+            storm::modelchecker::DFTModelChecker<double> sequentialChecker(false);
+            sequentialChecker.setNumberOfModuleThreads(1);
+            auto sequentialResults = sequentialChecker.check(*dft, properties, false, true, relevantEvents);
+
+            storm::modelchecker::DFTModelChecker<double> parallelChecker(false);
+            parallelChecker.setNumberOfModuleThreads(4);
+            auto parallelResults = parallelChecker.check(*dft, properties, false, true, relevantEvents);
+
+            ASSERT_EQ(1ul, sequentialResults.size());
+            ASSERT_EQ(1ul, parallelResults.size());
+            EXPECT_FLOAT_EQ(boost::get<double>(sequentialResults[0]), boost::get<double>(parallelResults[0])) << file;
+        }
+    }
 }
@@ -0,0 +1,70 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/builder/DFTBuilder.h"
+#include "storm-dft/modelchecker/dft/DFTResultCache.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/GeneralSettings.h"
+
+namespace {
+
+    storm::storage::DFT<double> buildDft(std::string const& prefix, bool swapChildren, double failureRate) {
+        storm::builder::DFTBuilder<double> builder;
+        builder.addBasicElementExponential(prefix + "A", 0.1, 1);
+        builder.addBasicElementExponential(prefix + "B", failureRate, 1);
+        builder.addBasicElementExponential(prefix + "C", 0.3, 1);
+        std::vector<std::string> children = {prefix + "A", prefix + "B"};
+        if (swapChildren) {
+            std::swap(children[0], children[1]);
+        }
+        builder.addOrElement(prefix + "Or", children);
+        builder.addPandElement(prefix + "Pand", {prefix + "Or", prefix + "C"});
+        builder.setTopLevel(prefix + "Pand");
+        return builder.build();
+    }
+
+    TEST(DftResultCacheTest, CanonicalForm) {
+        storm::utility::RelevantEvents noRelevantEvents;
+        std::string canonicalForm = storm::modelchecker::DFTResultCache<double>::canonicalForm(buildDft("x", false, 0.2), noRelevantEvents);
+        // Names and the order of children of static gates are irrelevant
+        EXPECT_EQ(canonicalForm, storm::modelchecker::DFTResultCache<double>::canonicalForm(buildDft("y", true, 0.2), noRelevantEvents));
+        // Failure rates and relevant events are not
+        EXPECT_NE(canonicalForm, storm::modelchecker::DFTResultCache<double>::canonicalForm(buildDft("x", false, 0.25), noRelevantEvents));
+        EXPECT_NE(canonicalForm, storm::modelchecker::DFTResultCache<double>::canonicalForm(buildDft("x", false, 0.2), storm::utility::RelevantEvents({"xA"})));
+    }
+
+    TEST(DftResultCacheTest, ReuseIsomorphicModules) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft");
+        EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=100 \"failed\"]"));
+        double expected = boost::get<double>(storm::api::analyzeDFT<double>(*dft, properties, false, true)[0]);
+
+        auto cache = std::make_shared<storm::modelchecker::DFTResultCache<double>>();
+        storm::modelchecker::DFTModelChecker<double> checker(false);
+        checker.setResultCache(cache);
+        // Both subsystems are isomorphic
+        EXPECT_FLOAT_EQ(expected, boost::get<double>(checker.check(*dft, properties, false, true)[0]));
+        EXPECT_LE(1ul, cache->getNumberOfHits());
+
+        // The second analysis only uses the cache
+        size_t hits = cache->getNumberOfHits();
+        size_t cachedResults = cache->size();
+        storm::modelchecker::DFTModelChecker<double> secondChecker(false);
+        secondChecker.setResultCache(cache);
+        EXPECT_FLOAT_EQ(expected, boost::get<double>(secondChecker.check(*dft, properties, false, true)[0]));
+        EXPECT_EQ(hits + 1, cache->getNumberOfHits());
+        EXPECT_EQ(cachedResults, cache->size());
+
+        // Results obtained with different solver settings are not reused
+        auto& generalSettings = dynamic_cast<storm::settings::modules::GeneralSettings&>(storm::settings::mutableManager().getModule(storm::settings::modules::GeneralSettings::moduleName));
+        std::unique_ptr<storm::settings::SettingMemento> bisimulation = generalSettings.overrideOption("bisimulation", true);
+        storm::modelchecker::DFTModelChecker<double> thirdChecker(false);
+        thirdChecker.setResultCache(cache);
+        EXPECT_FLOAT_EQ(expected, boost::get<double>(thirdChecker.check(*dft, properties, false, true)[0]));
+        EXPECT_LT(cachedResults, cache->size());
+    }
+
+}
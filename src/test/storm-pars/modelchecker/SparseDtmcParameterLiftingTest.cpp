@@ -97,6 +97,38 @@ namespace {
     
     }
 
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_refinement_concurrent) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+
+        // Program and formula
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+
+        //start testing
+        auto exBothRegion=storm::api::parseRegion<storm::RationalFunction>("0.4<=pL<=0.65,0.75<=pK<=0.95", modelParameters);
+        boost::optional<storm::RationalFunction> coverageThreshold = storm::utility::zero<storm::RationalFunction>();
+
+        // Without coverage threshold, the refinement yields the same regions regardless of the order in which the regions are analyzed
+        auto sequentialResult = regionChecker->performRegionRefinement(this->env(), exBothRegion, coverageThreshold, 4);
+        auto concurrentResult = regionChecker->performRegionRefinement(this->env(), exBothRegion, coverageThreshold, 4, storm::modelchecker::RegionResultHypothesis::Unknown, 4);
+        EXPECT_EQ(sequentialResult->getRegionResults().size(), concurrentResult->getRegionResults().size());
+        EXPECT_EQ(sequentialResult->getSatFraction(), concurrentResult->getSatFraction());
+        EXPECT_EQ(sequentialResult->getUnsatFraction(), concurrentResult->getUnsatFraction());
+        EXPECT_LT(storm::utility::zero<typename storm::storage::ParameterRegion<storm::RationalFunction>::CoefficientType>(), concurrentResult->getSatFraction());
+    }
+
     TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
         typedef typename TestFixture::ValueType ValueType;
 
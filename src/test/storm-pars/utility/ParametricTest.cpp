@@ -0,0 +1,35 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+
+#include "storm-pars/utility/parametric.h"
+
+TEST(ParametricTest, DeepCopy) {
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+    parser.setVariables({"p", "q"});
+
+    // The large coefficients are not stored inline
+    auto nominator = storm::Polynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>("123456789012345678901234567890*p^2 + 1/3*q"), cache);
+    auto denominator = storm::Polynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>("p + 98765432109876543210"), cache);
+    storm::RationalFunction function(nominator, denominator);
+
+    std::shared_ptr<storm::RawPolynomialCache> copyCache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunction copy = storm::utility::parametric::deepCopy(function, copyCache);
+    EXPECT_EQ(function, copy);
+
+    storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+    for (auto const& variable : function.gatherVariables()) {
+        valuation.emplace(variable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("2/7")));
+    }
+    EXPECT_EQ(storm::utility::parametric::evaluate(function, valuation), storm::utility::parametric::evaluate(copy, valuation));
+
+    storm::RationalFunction constant(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(std::string("12345678901234567890123/4567")));
+    EXPECT_EQ(constant, storm::utility::parametric::deepCopy(constant, copyCache));
+}
+
+#endif
@@ -0,0 +1,266 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_Z3
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "storm-pomdp/analysis/IterativePolicySearchPortfolio.h"
+#include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm/solver/Z3SmtSolver.h"
+#include "storm/utility/solver.h"
+#include "storm/exceptions/UnexpectedException.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+namespace {
+    typedef storm::pomdp::IterativePolicySearchPortfolio<double> Portfolio;
+
+    Portfolio::Configuration buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        auto formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        Portfolio::Configuration configuration;
+        configuration.pomdp = storm::api::buildSparseModel<double>(program, {formula})->template as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*configuration.pomdp);
+        configuration.pomdp = makeCanonic.transform();
+        storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*configuration.pomdp);
+        configuration.surelyReachSinkStates = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+        configuration.pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(configuration.surelyReachSinkStates);
+        configuration.targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+        configuration.lookahead = configuration.pomdp->getNumberOfStates();
+        return configuration;
+    }
+
+    // Creates one configuration per type of path variables (all on the same POMDP).
+    std::vector<Portfolio::Configuration> createConfigurations(Portfolio::Configuration const& base) {
+        std::vector<Portfolio::Configuration> configurations;
+        for (auto const& pathVariableType : {storm::pomdp::MemlessSearchPathVariables::RealRanking, storm::pomdp::MemlessSearchPathVariables::IntegerRanking, storm::pomdp::MemlessSearchPathVariables::BooleanRanking}) {
+            Portfolio::Configuration configuration = base;
+            configuration.options.pathVariableType = pathVariableType;
+            configuration.name = "path variables " + std::to_string(configurations.size());
+            configurations.push_back(configuration);
+        }
+        return configurations;
+    }
+
+    // Runs a single search with the given configuration (as done by the portfolio).
+    struct SingleResult {
+        bool initialStatesWinning;
+        storm::pomdp::WinningRegion winningRegion;
+    };
+
+    SingleResult analyzeSingle(Portfolio::Configuration const& configuration) {
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+        storm::pomdp::IterativePolicySearch<double> search(*configuration.pomdp, configuration.targetStates, configuration.surelyReachSinkStates, smtSolverFactory, configuration.options);
+        SingleResult result;
+        result.initialStatesWinning = search.analyze(configuration.lookahead, ~configuration.surelyReachSinkStates & ~configuration.targetStates, configuration.pomdp->getInitialStates());
+        result.winningRegion = search.getLastWinningRegion();
+        return result;
+    }
+
+    // Checks that both winning regions contain the same belief supports.
+    void expectSameWinningRegion(storm::pomdp::WinningRegion const& first, storm::pomdp::WinningRegion const& second) {
+        ASSERT_EQ(first.getNumberOfObservations(), second.getNumberOfObservations());
+        for (uint64_t observation = 0; observation < first.getNumberOfObservations(); ++observation) {
+            EXPECT_EQ(first.observationIsWinning(observation), second.observationIsWinning(observation)) << "Observation " << observation;
+            for (auto const& winningSet : first.getWinningSetsPerObservation(observation)) {
+                EXPECT_TRUE(second.query(observation, winningSet)) << "Observation " << observation << ", belief support " << winningSet;
+            }
+            for (auto const& winningSet : second.getWinningSetsPerObservation(observation)) {
+                EXPECT_TRUE(first.query(observation, winningSet)) << "Observation " << observation << ", belief support " << winningSet;
+            }
+        }
+        EXPECT_EQ(first.computeNrWinningBeliefs(), second.computeNrWinningBeliefs());
+    }
+
+    void compareWithSingleSearch(Portfolio::Configuration const& base, uint64_t numberOfThreads) {
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+        Portfolio portfolio(smtSolverFactory);
+        for (auto const& configuration : createConfigurations(base)) {
+            portfolio.addConfiguration(configuration);
+        }
+        auto result = portfolio.analyzeForInitialStates(numberOfThreads);
+        EXPECT_EQ(analyzeSingle(portfolio.getConfigurations().front()).initialStatesWinning, result.initialStatesWinning);
+        EXPECT_EQ(result.initialStatesWinning, result.winningConfiguration.is_initialized());
+        EXPECT_EQ(result.initialStatesWinning, result.winningRegion.is_initialized());
+        if (result.winningConfiguration) {
+            SingleResult single = analyzeSingle(portfolio.getConfigurations()[result.winningConfiguration.get()]);
+            EXPECT_TRUE(single.initialStatesWinning);
+            expectSameWinningRegion(single.winningRegion, result.winningRegion.get());
+        }
+    }
+
+    /*!
+     * Shared state of the solvers created by a ControlledSmtSolverFactory.
+     */
+    struct SolverControl {
+        enum class Behavior { Normal, WaitForBlockedSolver, BlockUntilInterrupted, FailOnCreation };
+
+        // The behavior of the i-th created solver. Further solvers behave normally.
+        std::vector<Behavior> behaviors;
+        std::mutex mutex;
+        std::condition_variable changed;
+        uint64_t createdSolvers = 0;
+        uint64_t blockedSolvers = 0;
+        uint64_t interruptedSolvers = 0;
+    };
+
+    // Safety net so that a test fails instead of hanging if the portfolio does not behave as expected.
+    std::chrono::seconds const maximalWaitingTime(60);
+
+    /*!
+     * A Z3 solver whose queries can be held back to control the order in which the configurations of a portfolio finish.
+     */
+    class ControlledSmtSolver : public storm::solver::Z3SmtSolver {
+    public:
+        ControlledSmtSolver(storm::expressions::ExpressionManager& manager, std::shared_ptr<SolverControl> const& control, SolverControl::Behavior behavior) : Z3SmtSolver(manager), control(control), behavior(behavior) {
+            // Intentionally left empty
+        }
+
+        virtual CheckResult check() override {
+            return waitForTurn() ? Z3SmtSolver::check() : CheckResult::Unknown;
+        }
+
+        virtual CheckResult checkWithAssumptions(std::set<storm::expressions::Expression> const& assumptions) override {
+            return waitForTurn() ? Z3SmtSolver::checkWithAssumptions(assumptions) : CheckResult::Unknown;
+        }
+
+        virtual CheckResult checkWithAssumptions(std::initializer_list<storm::expressions::Expression> const& assumptions) override {
+            return waitForTurn() ? Z3SmtSolver::checkWithAssumptions(assumptions) : CheckResult::Unknown;
+        }
+
+        virtual bool interrupt() override {
+            {
+                std::lock_guard<std::mutex> lock(control->mutex);
+                if (!interrupted) {
+                    interrupted = true;
+                    ++control->interruptedSolvers;
+                }
+            }
+            control->changed.notify_all();
+            return Z3SmtSolver::interrupt();
+        }
+
+    private:
+        // Returns false if the query is to be answered with 'unknown' as the solver has been interrupted.
+        bool waitForTurn() {
+            std::unique_lock<std::mutex> lock(control->mutex);
+            if (behavior == SolverControl::Behavior::WaitForBlockedSolver) {
+                control->changed.wait_for(lock, maximalWaitingTime, [this] { return control->blockedSolvers > 0; });
+            } else if (behavior == SolverControl::Behavior::BlockUntilInterrupted && !interrupted) {
+                ++control->blockedSolvers;
+                control->changed.notify_all();
+                control->changed.wait_for(lock, maximalWaitingTime, [this] { return interrupted; });
+            }
+            return !interrupted;
+        }
+
+        std::shared_ptr<SolverControl> control;
+        SolverControl::Behavior behavior;
+        bool interrupted = false;
+    };
+
+    class ControlledSmtSolverFactory : public storm::utility::solver::SmtSolverFactory {
+    public:
+        ControlledSmtSolverFactory(std::shared_ptr<SolverControl> const& control) : control(control) {
+            // Intentionally left empty
+        }
+
+        virtual std::unique_ptr<storm::solver::SmtSolver> create(storm::expressions::ExpressionManager& manager) const override {
+            SolverControl::Behavior behavior = SolverControl::Behavior::Normal;
+            {
+                std::lock_guard<std::mutex> lock(control->mutex);
+                if (control->createdSolvers < control->behaviors.size()) {
+                    behavior = control->behaviors[control->createdSolvers];
+                }
+                ++control->createdSolvers;
+            }
+            STORM_LOG_THROW(behavior != SolverControl::Behavior::FailOnCreation, storm::exceptions::UnexpectedException, "Solver creation failed on purpose.");
+            return std::make_unique<ControlledSmtSolver>(manager, control, behavior);
+        }
+
+    private:
+        std::shared_ptr<SolverControl> control;
+    };
+
+    TEST(IterativePolicySearchPortfolioTest, simple_SameAsSingleSearch) {
+        for (uint64_t numberOfThreads : {0ull, 1ull, 2ull}) {
+            compareWithSingleSearch(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0"), numberOfThreads);
+            compareWithSingleSearch(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4"), numberOfThreads);
+        }
+    }
+
+    TEST(IterativePolicySearchPortfolioTest, maze2_SameAsSingleSearch) {
+        compareWithSingleSearch(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0"), 0);
+        compareWithSingleSearch(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0.075"), 0);
+    }
+
+    TEST(IterativePolicySearchPortfolioTest, FirstFinisherWins) {
+        auto base = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+        ASSERT_TRUE(analyzeSingle(base).initialStatesWinning);
+        auto control = std::make_shared<SolverControl>();
+        Portfolio portfolio(std::make_shared<ControlledSmtSolverFactory>(control));
+        for (auto const& configuration : createConfigurations(base)) {
+            portfolio.addConfiguration(configuration);
+        }
+        // With a single thread, the configurations are started in the given order and the first one already wins.
+        auto result = portfolio.analyzeForInitialStates(1);
+        EXPECT_TRUE(result.initialStatesWinning);
+        ASSERT_TRUE(result.winningConfiguration.is_initialized());
+        EXPECT_EQ(0ull, result.winningConfiguration.get());
+        EXPECT_EQ(1ull, control->createdSolvers);
+    }
+
+    TEST(IterativePolicySearchPortfolioTest, OthersAreInterrupted) {
+        auto base = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+        ASSERT_TRUE(analyzeSingle(base).initialStatesWinning);
+        auto control = std::make_shared<SolverControl>();
+        // The second search blocks in its first query, the first one only proceeds once this happened.
+        control->behaviors = {SolverControl::Behavior::WaitForBlockedSolver, SolverControl::Behavior::BlockUntilInterrupted};
+        Portfolio portfolio(std::make_shared<ControlledSmtSolverFactory>(control));
+        auto configurations = createConfigurations(base);
+        portfolio.addConfiguration(configurations[0]);
+        portfolio.addConfiguration(configurations[1]);
+        auto result = portfolio.analyzeForInitialStates(2);
+        EXPECT_TRUE(result.initialStatesWinning);
+        ASSERT_TRUE(result.winningConfiguration.is_initialized());
+        EXPECT_EQ(2ull, control->createdSolvers);
+        EXPECT_EQ(1ull, control->blockedSolvers);
+        // Only the blocked search is aborted, which interrupts its solver.
+        EXPECT_EQ(1ull, control->interruptedSolvers);
+        SingleResult single = analyzeSingle(portfolio.getConfigurations()[result.winningConfiguration.get()]);
+        expectSameWinningRegion(single.winningRegion, result.winningRegion.get());
+    }
+
+    TEST(IterativePolicySearchPortfolioTest, ExceptionsPropagate) {
+        auto base = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+        {
+            auto control = std::make_shared<SolverControl>();
+            control->behaviors = {SolverControl::Behavior::FailOnCreation};
+            Portfolio portfolio(std::make_shared<ControlledSmtSolverFactory>(control));
+            for (auto const& configuration : createConfigurations(base)) {
+                portfolio.addConfiguration(configuration);
+            }
+            // The failure stops the portfolio, so no further configuration is started.
+            STORM_SILENT_EXPECT_THROW(portfolio.analyzeForInitialStates(1), storm::exceptions::UnexpectedException);
+            EXPECT_EQ(1ull, control->createdSolvers);
+        }
+        {
+            auto control = std::make_shared<SolverControl>();
+            // The first search blocks until it is aborted due to the failure of the second one.
+            control->behaviors = {SolverControl::Behavior::BlockUntilInterrupted, SolverControl::Behavior::FailOnCreation};
+            Portfolio portfolio(std::make_shared<ControlledSmtSolverFactory>(control));
+            auto configurations = createConfigurations(base);
+            portfolio.addConfiguration(configurations[0]);
+            portfolio.addConfiguration(configurations[1]);
+            STORM_SILENT_EXPECT_THROW(portfolio.analyzeForInitialStates(2), storm::exceptions::UnexpectedException);
+            EXPECT_EQ(2ull, control->createdSolvers);
+            // The first search may also be aborted before it reaches its first query, but it must not remain blocked.
+            EXPECT_LE(control->blockedSolvers, control->interruptedSolvers);
+        }
+    }
+}
+#endif
@@ -0,0 +1,83 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_Z3
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm/utility/solver.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+namespace {
+    struct Input {
+        std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp;
+        storm::storage::BitVector targetStates;
+        storm::storage::BitVector surelyReachSinkStates;
+    };
+
+    Input buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        auto formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        Input input;
+        input.pomdp = storm::api::buildSparseModel<double>(program, {formula})->template as<storm::models::sparse::Pomdp<double>>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*input.pomdp);
+        input.pomdp = makeCanonic.transform();
+        storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*input.pomdp);
+        input.surelyReachSinkStates = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+        input.pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(input.surelyReachSinkStates);
+        input.targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+        return input;
+    }
+
+    storm::pomdp::WinningRegion computeWinningRegion(Input const& input, bool incrementalEncoding, storm::pomdp::MemlessSearchPathVariables pathVariableType) {
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+        storm::pomdp::MemlessSearchOptions options;
+        options.incrementalEncoding = incrementalEncoding;
+        options.pathVariableType = pathVariableType;
+        // Restart often so that the encoding is reused (or rebuilt) several times.
+        options.restartAfterNIterations = 2;
+        storm::pomdp::IterativePolicySearch<double> search(*input.pomdp, input.targetStates, input.surelyReachSinkStates, smtSolverFactory, options);
+        search.computeWinningRegion(input.pomdp->getNumberOfStates());
+        return search.getLastWinningRegion();
+    }
+
+    // Checks that both winning regions contain the same belief supports.
+    void expectSameWinningRegion(storm::pomdp::WinningRegion const& first, storm::pomdp::WinningRegion const& second) {
+        ASSERT_EQ(first.getNumberOfObservations(), second.getNumberOfObservations());
+        for (uint64_t observation = 0; observation < first.getNumberOfObservations(); ++observation) {
+            EXPECT_EQ(first.observationIsWinning(observation), second.observationIsWinning(observation)) << "Observation " << observation;
+            for (auto const& winningSet : first.getWinningSetsPerObservation(observation)) {
+                EXPECT_TRUE(second.query(observation, winningSet)) << "Observation " << observation << ", belief support " << winningSet;
+            }
+            for (auto const& winningSet : second.getWinningSetsPerObservation(observation)) {
+                EXPECT_TRUE(first.query(observation, winningSet)) << "Observation " << observation << ", belief support " << winningSet;
+            }
+        }
+        EXPECT_EQ(first.computeNrWinningBeliefs(), second.computeNrWinningBeliefs());
+    }
+
+    void compareEncodings(Input const& input) {
+        for (auto const& pathVariableType : {storm::pomdp::MemlessSearchPathVariables::RealRanking, storm::pomdp::MemlessSearchPathVariables::IntegerRanking, storm::pomdp::MemlessSearchPathVariables::BooleanRanking}) {
+            auto incremental = computeWinningRegion(input, true, pathVariableType);
+            auto resetBased = computeWinningRegion(input, false, pathVariableType);
+            expectSameWinningRegion(incremental, resetBased);
+        }
+    }
+
+    TEST(IterativePolicySearchTest, simple_IncrementalEncoding) {
+        compareEncodings(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0"));
+        compareEncodings(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4"));
+    }
+
+    TEST(IterativePolicySearchTest, maze2_IncrementalEncoding) {
+        compareEncodings(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0"));
+        compareEncodings(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0.075"));
+    }
+
+    TEST(IterativePolicySearchTest, refuel_IncrementalEncoding) {
+        compareEncodings(buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4"));
+    }
+}
+#endif
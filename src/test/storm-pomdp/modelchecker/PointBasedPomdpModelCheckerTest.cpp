@@ -0,0 +1,122 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-pomdp/modelchecker/PointBasedPomdpModelChecker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+
+namespace {
+    class DefaultDoubleEnvironment {
+    public:
+        typedef double ValueType;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.12); } // there actually aren't any precision guarantees, but we still want to detect if results are weird.
+        static void adaptOptions(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType>&) { /* intentionally left empty */ }
+    };
+
+    class FewBeliefsDoubleEnvironment {
+    public:
+        typedef double ValueType;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.5); }
+        static void adaptOptions(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType>& options) { options.numberOfBeliefs = 3; options.maxIterations = 5; }
+    };
+
+    class DefaultRationalEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.12); }
+        static void adaptOptions(storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType>& options) { options.numberOfBeliefs = 100; options.maxIterations = 50; }
+    };
+
+    template<typename TestType>
+    class PointBasedTest : public ::testing::Test {
+    public:
+        typedef typename TestType::ValueType ValueType;
+        storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> options() const {
+            storm::pomdp::modelchecker::PointBasedPomdpModelCheckerOptions<ValueType> opt;
+            TestType::adaptOptions(opt);
+            return opt;
+        }
+        ValueType parseNumber(std::string const& str) {
+            return storm::utility::convertNumber<ValueType>(str);
+        }
+        struct Input {
+            std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> model;
+            std::shared_ptr<storm::logic::Formula const> formula;
+        };
+        Input buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") const {
+            storm::prism::Program program = storm::api::parseProgram(programFile);
+            program = storm::utility::prism::preprocess(program, constantsAsString);
+            Input input;
+            input.formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+            input.model = storm::api::buildSparseModel<ValueType>(program, {input.formula})->template as<storm::models::sparse::Pomdp<ValueType>>();
+            storm::transformer::MakePOMDPCanonic<ValueType> makeCanonic(*input.model);
+            input.model = makeCanonic.transform();
+            EXPECT_TRUE(input.model->isCanonic());
+            return input;
+        }
+        ValueType precision() const { return TestType::precision(); }
+        ValueType modelcheckingPrecision() const { if (storm::NumberTraits<ValueType>::IsExact) return storm::utility::zero<ValueType>(); else return storm::utility::convertNumber<ValueType>(1e-6); }
+    };
+
+    typedef ::testing::Types<
+            DefaultDoubleEnvironment,
+            FewBeliefsDoubleEnvironment,
+            DefaultRationalEnvironment
+    > TestingTypes;
+
+    TYPED_TEST_SUITE(PointBasedTest, TestingTypes,);
+
+    TYPED_TEST(PointBasedTest, simple_Pmax) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+
+        ValueType expected = this->parseNumber("7/10");
+        EXPECT_TRUE(result.isLowerBound);
+        EXPECT_LE(result.bound, expected + this->modelcheckingPrecision());
+        EXPECT_GE(result.bound, expected - this->precision()) << "Bound " << result.bound << " is not precise enough. If (only) this fails, the bound is still correct, but it might be unexpectedly imprecise." << std::endl;
+    }
+
+    TYPED_TEST(PointBasedTest, simple_slippery_Pmin) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmin=? [F \"goal\" ]", "slippery=0.4");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+
+        ValueType expected = this->parseNumber("3/10");
+        EXPECT_FALSE(result.isLowerBound);
+        EXPECT_GE(result.bound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.bound, expected + this->precision()) << "Bound " << result.bound << " is not precise enough. If (only) this fails, the bound is still correct, but it might be unexpectedly imprecise." << std::endl;
+    }
+
+    TYPED_TEST(PointBasedTest, simple_Rmin) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Rmin=? [F s>4 ]", "slippery=0");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+
+        ValueType expected = this->parseNumber("19/50");
+        EXPECT_FALSE(result.isLowerBound);
+        EXPECT_GE(result.bound, expected - this->modelcheckingPrecision());
+        EXPECT_LE(result.bound, expected + this->precision()) << "Bound " << result.bound << " is not precise enough. If (only) this fails, the bound is still correct, but it might be unexpectedly imprecise." << std::endl;
+    }
+
+    TYPED_TEST(PointBasedTest, refuel_Pmax) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        auto data = this->buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=?[\"notbad\" U \"goal\"]", "N=4");
+        storm::pomdp::modelchecker::PointBasedPomdpModelChecker<storm::models::sparse::Pomdp<ValueType>> checker(data.model, this->options());
+        auto result = checker.check(*data.formula);
+
+        // Only check that the bound is sound
+        ValueType expected = this->parseNumber("38/155");
+        EXPECT_TRUE(result.isLowerBound);
+        EXPECT_LE(result.bound, expected + this->modelcheckingPrecision());
+    }
+}
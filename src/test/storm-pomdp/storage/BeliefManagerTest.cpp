@@ -0,0 +1,106 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <set>
+
+#include "storm-pomdp/storage/BeliefManager.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+namespace {
+    typedef storm::models::sparse::Pomdp<double> PomdpType;
+    typedef storm::storage::BeliefManager<PomdpType> BeliefManagerType;
+    typedef std::vector<std::vector<std::pair<BeliefManagerType::BeliefId, double>>> Transitions;
+
+    std::shared_ptr<PomdpType> buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString = "") {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        auto formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+        auto pomdp = storm::api::buildSparseModel<double>(program, {formula})->template as<PomdpType>();
+        storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+        return makeCanonic.transform();
+    }
+
+    // Expands the beliefs breadth-first (layer by layer) until more than the given number of beliefs is known.
+    // Returns the successors of all expanded beliefs and actions in the order of expansion.
+    Transitions explore(BeliefManagerType& manager, uint64_t maxNumberOfBeliefs, bool prefetch, boost::optional<std::vector<double>> const& resolutions = boost::none) {
+        Transitions transitions;
+        // As ids are assigned consecutively, the beliefs of the current layer are the ones with ids in [layerStart, layerEnd).
+        uint64_t layerStart = manager.getInitialBelief();
+        while (layerStart < manager.getNumberOfBeliefIds() && manager.getNumberOfBeliefIds() <= maxNumberOfBeliefs) {
+            uint64_t layerEnd = manager.getNumberOfBeliefIds();
+            if (prefetch) {
+                std::vector<BeliefManagerType::BeliefId> layer;
+                for (uint64_t id = layerStart; id < layerEnd; ++id) {
+                    layer.push_back(id);
+                }
+                manager.prefetchSuccessors(layer, resolutions);
+            }
+            for (uint64_t id = layerStart; id < layerEnd; ++id) {
+                for (uint64_t action = 0; action < manager.getBeliefNumberOfChoices(id); ++action) {
+                    if (resolutions) {
+                        transitions.push_back(manager.expandAndTriangulate(id, action, resolutions.get()));
+                    } else {
+                        transitions.push_back(manager.expand(id, action));
+                    }
+                }
+            }
+            layerStart = layerEnd;
+        }
+        manager.clearPrefetchedSuccessors();
+        return transitions;
+    }
+
+    std::vector<BeliefManagerType::BeliefType> getBeliefs(BeliefManagerType const& manager) {
+        std::vector<BeliefManagerType::BeliefType> beliefs;
+        for (uint64_t id = 0; id < manager.getNumberOfBeliefIds(); ++id) {
+            beliefs.push_back(manager.getBeliefCopy(id));
+        }
+        return beliefs;
+    }
+
+    TEST(BeliefManagerTest, StableIdsAndExactLookup) {
+        auto pomdp = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0.075");
+        BeliefManagerType manager(*pomdp, 1e-6, BeliefManagerType::TriangulationMode::Static);
+        Transitions transitions = explore(manager, 2000, false);
+        uint64_t numberOfBeliefs = manager.getNumberOfBeliefIds();
+        // The lookup table initially holds 1024 slots and is kept at most half full, so it has grown (at least twice).
+        ASSERT_GT(numberOfBeliefs, 1024ull);
+        std::vector<BeliefManagerType::BeliefType> beliefs = getBeliefs(manager);
+
+        // Each belief is stored exactly once.
+        std::set<BeliefManagerType::BeliefType> distinctBeliefs(beliefs.begin(), beliefs.end());
+        EXPECT_EQ(numberOfBeliefs, distinctBeliefs.size());
+
+        // Expanding the beliefs again finds all successors under their previous ids and does not add any beliefs.
+        Transitions::const_iterator transitionIt = transitions.begin();
+        for (uint64_t id = 0; id < numberOfBeliefs && transitionIt != transitions.end(); ++id) {
+            for (uint64_t action = 0; action < manager.getBeliefNumberOfChoices(id); ++action, ++transitionIt) {
+                EXPECT_EQ(*transitionIt, manager.expand(id, action)) << "Belief " << id << ", action " << action;
+            }
+        }
+        EXPECT_EQ(transitions.end(), transitionIt);
+        EXPECT_EQ(numberOfBeliefs, manager.getNumberOfBeliefIds());
+
+        // The stored beliefs did not change.
+        EXPECT_EQ(beliefs, getBeliefs(manager));
+    }
+
+    TEST(BeliefManagerTest, PrefetchingYieldsSameIds) {
+        auto pomdp = buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "Pmax=? [F \"goal\" ]", "sl=0.075");
+        {
+            BeliefManagerType manager(*pomdp, 1e-6, BeliefManagerType::TriangulationMode::Static);
+            BeliefManagerType prefetchingManager(*pomdp, 1e-6, BeliefManagerType::TriangulationMode::Static);
+            EXPECT_EQ(explore(manager, 2000, false), explore(prefetchingManager, 2000, true));
+            EXPECT_EQ(getBeliefs(manager), getBeliefs(prefetchingManager));
+        }
+        {
+            std::vector<double> resolutions(pomdp->getNrObservations(), 4.0);
+            BeliefManagerType manager(*pomdp, 1e-6, BeliefManagerType::TriangulationMode::Static);
+            BeliefManagerType prefetchingManager(*pomdp, 1e-6, BeliefManagerType::TriangulationMode::Static);
+            EXPECT_EQ(explore(manager, 2000, false, resolutions), explore(prefetchingManager, 2000, true, resolutions));
+            EXPECT_EQ(getBeliefs(manager), getBeliefs(prefetchingManager));
+        }
+    }
+}
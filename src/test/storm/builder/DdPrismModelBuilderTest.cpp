@@ -8,6 +8,7 @@
 #include "storm/models/symbolic/Ctmc.h"
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 
@@ -77,6 +78,30 @@ TEST(DdPrismModelBuilderTest_Cudd, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(DdPrismModelBuilderTest_Cudd, ExplicitMatrix) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    
+    auto matrix = model->getExplicitMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    EXPECT_EQ(13ul, matrix->getRowCount());
+    EXPECT_EQ(20ul, matrix->getEntryCount());
+    
+    // Requesting the same matrix again must not translate it again.
+    EXPECT_EQ(matrix, model->getExplicitMatrix(model->getTransitionMatrix(), model->getReachableStates()));
+    
+    // Other states replace the cached matrix, but matrices that were already retrieved stay valid.
+    auto initialMatrix = model->getExplicitMatrix(model->getTransitionMatrix(), model->getInitialStates());
+    EXPECT_EQ(1ul, initialMatrix->getRowCount());
+    EXPECT_NE(matrix, initialMatrix);
+    EXPECT_EQ(20ul, matrix->getEntryCount());
+    
+    model->clearExplicitMatrixCache();
+    auto recomputedMatrix = model->getExplicitMatrix(model->getTransitionMatrix(), model->getReachableStates());
+    EXPECT_NE(matrix, recomputedMatrix);
+    EXPECT_EQ(*matrix, *recomputedMatrix);
+}
+
 TEST(DdPrismModelBuilderTest_Sylvan, Ctmc) {
 
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
@@ -0,0 +1,60 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(DdVariableOrderingTest, Declaration) {
+    storm::expressions::ExpressionManager manager;
+    std::vector<storm::expressions::Variable> variables = {manager.declareBooleanVariable("a"), manager.declareBooleanVariable("b"), manager.declareBooleanVariable("c")};
+    
+    storm::builder::DdVariableOrdering ordering(variables);
+    ordering.addDependency({variables[0], variables[2]});
+    
+    EXPECT_EQ(variables, ordering.computeOrder(storm::builder::DdVariableOrderingHeuristic::Declaration));
+    EXPECT_EQ(2ull, ordering.getTotalSpan(variables));
+}
+
+TEST(DdVariableOrderingTest, Force) {
+    storm::expressions::ExpressionManager manager;
+    std::vector<storm::expressions::Variable> variables;
+    for (uint64_t index = 0; index < 6; ++index) {
+        variables.push_back(manager.declareBooleanVariable("x" + std::to_string(index)));
+    }
+    
+    // The declaration order interleaves two independent groups of variables.
+    storm::builder::DdVariableOrdering ordering(variables);
+    ordering.addDependency({variables[0], variables[2], variables[4]});
+    ordering.addDependency({variables[1], variables[3], variables[5]});
+    ordering.addDependency({variables[0], variables[2]});
+    ordering.addDependency({variables[1], variables[3]});
+    
+    std::vector<storm::expressions::Variable> order = ordering.computeOrder(storm::builder::DdVariableOrderingHeuristic::Force);
+    ASSERT_EQ(variables.size(), order.size());
+    EXPECT_EQ(std::set<storm::expressions::Variable>(variables.begin(), variables.end()), std::set<storm::expressions::Variable>(order.begin(), order.end()));
+    EXPECT_LT(ordering.getTotalSpan(order), ordering.getTotalSpan(variables));
+    
+    // Unknown variables and trivial dependencies are ignored.
+    ordering.addDependency({manager.declareBooleanVariable("y"), variables[0]});
+    EXPECT_EQ(order, ordering.computeOrder(storm::builder::DdVariableOrderingHeuristic::Force));
+}
+
+TEST(DdVariableOrderingTest, NodeCountForOrder) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    
+    // Create the variables in an order that separates the pairs of equal variables.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x0 = manager->addMetaVariable("x0");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x2 = manager->addMetaVariable("x2");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x1 = manager->addMetaVariable("x1");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x3 = manager->addMetaVariable("x3");
+    storm::dd::Bdd<storm::dd::DdType::CUDD> function = manager->getEncoding(x0.first, 1).iff(manager->getEncoding(x1.first, 1)) && manager->getEncoding(x2.first, 1).iff(manager->getEncoding(x3.first, 1));
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = function.template toAdd<double>();
+    std::size_t numberOfMetaVariables = manager->getNumberOfMetaVariables();
+    
+    EXPECT_EQ(dd.getNodeCount(), storm::builder::getNodeCountForOrder(dd, {x0, x2, x1, x3}));
+    EXPECT_LT(storm::builder::getNodeCountForOrder(dd, {x0, x1, x2, x3}), dd.getNodeCount());
+    
+    // Counting must not leave any variables behind in the manager.
+    EXPECT_EQ(numberOfMetaVariables, manager->getNumberOfMetaVariables());
+}
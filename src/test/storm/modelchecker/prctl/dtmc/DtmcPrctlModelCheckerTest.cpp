@@ -440,6 +440,23 @@ namespace {
         }
     };
 
+    class DdSylvanNativePowerExplicitFallbackEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+        static const DtmcEngine engine = DtmcEngine::PrismDd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().setSymbolicExplicitFallbackThreshold(1);
+            return env;
+        }
+    };
+
     class DdSylvanRationalSearchEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -581,6 +598,7 @@ namespace {
             DdSylvanNativePowerEnvironment,
             JaniDdSylvanNativePowerEnvironment,
             DdCuddNativeJacobiEnvironment,
+            DdSylvanNativePowerExplicitFallbackEnvironment,
             DdSylvanRationalSearchEnvironment
         > TestingTypes;
     
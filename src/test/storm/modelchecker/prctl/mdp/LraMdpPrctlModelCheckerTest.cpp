@@ -19,6 +19,9 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/storage/Scheduler.h"
 
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm-parsers/parser/AutoParser.h"
@@ -455,6 +458,76 @@ namespace {
         }
     }
     
+    TYPED_TEST(LraMdpPrctlModelCheckerTest, LRA_MultipleMecs) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        // State 0 chooses one of four MECs. In each MEC, the first state can either stay or move to the second state,
+        // which returns to the first one. Label a holds in the first state of even and the second state of odd MECs.
+        uint64_t const numberOfMecs = 4;
+        storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder(numberOfMecs * 4, 1 + 2 * numberOfMecs, numberOfMecs * 4, true, true, 1 + 2 * numberOfMecs);
+        storm::models::sparse::StateLabeling ap(1 + 2 * numberOfMecs);
+        ap.addLabel("a");
+        uint64_t row = 0;
+        matrixBuilder.newRowGroup(row);
+        for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+            matrixBuilder.addNextValue(row++, 1 + 2 * mec, this->parseNumber("1"));
+        }
+        for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+            uint64_t first = 1 + 2 * mec;
+            matrixBuilder.newRowGroup(row);
+            matrixBuilder.addNextValue(row++, first, this->parseNumber("1"));
+            matrixBuilder.addNextValue(row++, first + 1, this->parseNumber("1"));
+            matrixBuilder.newRowGroup(row);
+            matrixBuilder.addNextValue(row++, first, this->parseNumber("1"));
+            ap.addLabelToState("a", mec % 2 == 0 ? first : first + 1);
+        }
+        storm::models::sparse::Mdp<ValueType> mdp(matrixBuilder.build(), ap);
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> checker(mdp);
+        storm::parser::FormulaParser formulaParser;
+        
+        for (std::string const& formulaString : {"LRAmax=? [\"a\"]", "LRAmin=? [\"a\"]"}) {
+            bool maximize = formulaString.find("max") != std::string::npos;
+            std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+            for (bool produceScheduler : {false, true}) {
+                storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> task(*formula);
+                task.setProduceSchedulers(produceScheduler);
+                
+                std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult;
+                std::unique_ptr<storm::modelchecker::CheckResult> parallelResult;
+                {
+                    std::unique_ptr<storm::settings::SettingMemento> disableTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+                    sequentialResult = checker.check(this->env(), task);
+                }
+                {
+                    std::unique_ptr<storm::settings::SettingMemento> enableTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+                    parallelResult = checker.check(this->env(), task);
+                }
+                auto const& sequentialValues = sequentialResult->template asExplicitQuantitativeCheckResult<ValueType>();
+                auto const& parallelValues = parallelResult->template asExplicitQuantitativeCheckResult<ValueType>();
+                
+                EXPECT_NEAR(this->parseNumber(maximize ? "1" : "0"), sequentialValues[0], this->precision());
+                for (uint64_t mec = 0; mec < numberOfMecs; ++mec) {
+                    std::string expected = mec % 2 == 0 ? (maximize ? "1" : "1/2") : (maximize ? "1/2" : "0");
+                    EXPECT_NEAR(this->parseNumber(expected), sequentialValues[1 + 2 * mec], this->precision());
+                    EXPECT_NEAR(this->parseNumber(expected), sequentialValues[2 + 2 * mec], this->precision());
+                }
+                for (uint64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
+                    EXPECT_NEAR(sequentialValues[state], parallelValues[state], this->precision()) << "state " << state;
+                }
+                
+                ASSERT_EQ(produceScheduler, sequentialValues.hasScheduler());
+                ASSERT_EQ(produceScheduler, parallelValues.hasScheduler());
+                if (produceScheduler) {
+                    auto const& sequentialScheduler = sequentialValues.getScheduler();
+                    auto const& parallelScheduler = parallelValues.getScheduler();
+                    for (uint64_t state = 0; state < mdp.getNumberOfStates(); ++state) {
+                        EXPECT_EQ(sequentialScheduler.getChoice(state).getDeterministicChoice(), parallelScheduler.getChoice(state).getDeterministicChoice()) << "state " << state;
+                    }
+                }
+            }
+        }
+    }
+    
     TYPED_TEST(LraMdpPrctlModelCheckerTest, cs_nfail) {
         typedef typename TestFixture::ValueType ValueType;
 
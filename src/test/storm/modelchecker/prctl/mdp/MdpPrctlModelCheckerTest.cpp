@@ -179,6 +179,21 @@ namespace {
         }
     };
 
+    class SparseDoublePrioritizedValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const MdpEngine engine = MdpEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+
     class SparseDoubleTopologicalValueIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
@@ -370,6 +385,21 @@ namespace {
             return env;
         }
     };
+    class DdSylvanDoubleValueIterationExplicitFallbackEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+        static const MdpEngine engine = MdpEngine::PrismDd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            env.solver().setSymbolicExplicitFallbackThreshold(1);
+            return env;
+        }
+    };
     class DdCuddDoublePolicyIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -508,6 +538,7 @@ namespace {
             SparseDoubleIntervalIterationEnvironment,
             SparseDoubleSoundValueIterationEnvironment,
             SparseDoubleOptimisticValueIterationEnvironment,
+            SparseDoublePrioritizedValueIterationEnvironment,
             SparseDoubleTopologicalValueIterationEnvironment,
             SparseDoubleTopologicalSoundValueIterationEnvironment,
             SparseRationalPolicyIterationEnvironment,
@@ -521,6 +552,7 @@ namespace {
             DdCuddDoubleValueIterationEnvironment,
             JaniDdCuddDoubleValueIterationEnvironment,
             DdSylvanDoubleValueIterationEnvironment,
+            DdSylvanDoubleValueIterationExplicitFallbackEnvironment,
             DdCuddDoublePolicyIterationEnvironment,
             DdSylvanRationalRationalSearchEnvironment
         > TestingTypes;
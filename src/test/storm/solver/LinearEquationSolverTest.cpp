@@ -24,6 +24,77 @@ namespace {
         }
     };
     
+    class NativeDoubleMixedPrecisionPowerEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            env.solver().native().setMixedPrecision(true);
+            return env;
+        }
+    };
+    
+    class NativeDoubleAdaptiveCheckPowerEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            env.solver().native().setAdaptiveConvergenceCheck(true);
+            return env;
+        }
+    };
+    
+    class NativeDoubleBicgstabIluEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleGmresDiagonalEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+            env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Diagonal);
+            env.solver().native().setRestartThreshold(2);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleAggregationDisaggregationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleSoundValueIterationEnvironment {
     public:
         typedef double ValueType;
@@ -39,6 +110,22 @@ namespace {
         }
     };
     
+    class NativeDoubleSoundValueIterationRegularEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SoundValueIteration);
+            env.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            return env;
+        }
+    };
+    
     class NativeDoubleOptimisticValueIterationEnvironment {
     public:
         typedef double ValueType;
@@ -69,6 +156,22 @@ namespace {
         }
     };
     
+    class NativeDoubleIntervalIterationRegularEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setForceSoundness(true);
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::IntervalIteration);
+            env.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().native().setRelativeTerminationCriterion(false);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+            return env;
+        }
+    };
+    
     class NativeDoubleJacobiEnvironment {
     public:
         typedef double ValueType;
@@ -82,6 +185,20 @@ namespace {
         }
     };
     
+    class NativeDoubleAdaptiveCheckJacobiEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            env.solver().native().setAdaptiveConvergenceCheck(true);
+            return env;
+        }
+    };
+    
     class NativeDoubleGaussSeidelEnvironment {
     public:
         typedef double ValueType;
@@ -108,6 +225,32 @@ namespace {
         }
     };
     
+    class NativeDoubleMulticolorGaussSeidelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::MulticolorGaussSeidel);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleMulticolorSorEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::MulticolorSOR);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleWalkerChaeEnvironment {
     public:
         typedef double ValueType;
@@ -308,13 +451,23 @@ namespace {
   
     typedef ::testing::Types<
             NativeDoublePowerEnvironment,
+            NativeDoubleMixedPrecisionPowerEnvironment,
+            NativeDoubleAdaptiveCheckPowerEnvironment,
             NativeDoubleSoundValueIterationEnvironment,
+            NativeDoubleSoundValueIterationRegularEnvironment,
             NativeDoubleOptimisticValueIterationEnvironment,
             NativeDoubleIntervalIterationEnvironment,
+            NativeDoubleIntervalIterationRegularEnvironment,
             NativeDoubleJacobiEnvironment,
+            NativeDoubleAdaptiveCheckJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
+            NativeDoubleMulticolorGaussSeidelEnvironment,
+            NativeDoubleMulticolorSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
+            NativeDoubleBicgstabIluEnvironment,
+            NativeDoubleGmresDiagonalEnvironment,
+            NativeDoubleAggregationDisaggregationEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
             GmmGmresIluEnvironment,
@@ -369,4 +522,44 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
-}
\ No newline at end of file
+    
+    TYPED_TEST(LinearEquationSolverTest, solveNearlyDecomposableSystem) {
+        typedef typename TestFixture::ValueType ValueType;
+        // Two blocks {0,1} and {2,3} that are only weakly coupled.
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("1/2")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, this->parseNumber("1/1000")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, this->parseNumber("1/2")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, this->parseNumber("0")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 3, this->parseNumber("1/1000")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("1/1000")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 3, this->parseNumber("1/2")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 2, this->parseNumber("1/2")));
+        ASSERT_NO_THROW(builder.addNextValue(3, 3, this->parseNumber("0")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build(4, 4));
+        
+        std::vector<ValueType> x(4);
+        std::vector<ValueType> b = {this->parseNumber("499/1000"), this->parseNumber("0"), this->parseNumber("0"), this->parseNumber("1/2")};
+        
+        auto factory = storm::solver::GeneralLinearEquationSolverFactory<ValueType>();
+        if (factory.getEquationProblemFormat(this->env()) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+            A.convertToEquationSystem();
+        }
+        
+        auto requirements = factory.getRequirements(this->env());
+        requirements.clearUpperBounds();
+        requirements.clearLowerBounds();
+        ASSERT_FALSE(requirements.hasEnabledRequirement());
+        auto solver = factory.create(this->env(), A);
+        solver->setBounds(this->parseNumber("0"), this->parseNumber("1"));
+        ASSERT_NO_THROW(solver->solveEquations(this->env(), x, b));
+        EXPECT_NEAR(x[0], this->parseNumber("299800/449999"), this->precision());
+        EXPECT_NEAR(x[1], this->parseNumber("187750249/562498750"), this->precision());
+        EXPECT_NEAR(x[2], this->parseNumber("751997/2249995"), this->precision());
+        EXPECT_NEAR(x[3], this->parseNumber("1500996/2249995"), this->precision());
+    }
+}
@@ -5,6 +5,7 @@
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
@@ -24,6 +25,44 @@ namespace {
         }
     };
 
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setMixedPrecision(true);
+            return env;
+        }
+    };
+    class DoubleMixedPrecisionAbsoluteViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            env.solver().minMax().setMixedPrecision(true);
+            return env;
+        }
+    };
+    class DoubleAdaptiveCheckViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setAdaptiveConvergenceCheck(true);
+            return env;
+        }
+    };
     class DoubleSoundViEnvironment {
     public:
         typedef double ValueType;
@@ -37,6 +76,20 @@ namespace {
         }
     };
     
+    class DoubleSoundViRegularEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::SoundValueIteration);
+            env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
+    
     class DoubleIntervalIterationEnvironment {
     public:
         typedef double ValueType;
@@ -49,6 +102,20 @@ namespace {
             return env;
         }
     };
+    
+    class DoubleIntervalIterationRegularEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+            env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+            env.solver().setForceSoundness(true);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
 
     class DoubleOptimisticViEnvironment {
     public:
@@ -63,6 +130,17 @@ namespace {
         }
     };
     
+    class DoublePrioritizedViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PrioritizedValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
     class DoubleTopologicalViEnvironment {
     public:
         typedef double ValueType;
@@ -101,6 +179,19 @@ namespace {
             return env;
         }
     };
+    class DoubleEigenPIEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+            env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+            return env;
+        }
+    };
     class RationalPIEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -136,12 +227,19 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoubleMixedPrecisionViEnvironment,
+            DoubleMixedPrecisionAbsoluteViEnvironment,
+            DoubleAdaptiveCheckViEnvironment,
             DoubleSoundViEnvironment,
+            DoubleSoundViRegularEnvironment,
             DoubleIntervalIterationEnvironment,
+            DoubleIntervalIterationRegularEnvironment,
             DoubleOptimisticViEnvironment,
+            DoublePrioritizedViEnvironment,
             DoubleTopologicalViEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
+            DoubleEigenPIEnvironment,
             RationalPIEnvironment,
             RationalRationalSearchEnvironment
     > TestingTypes;
@@ -20,6 +20,18 @@ namespace {
         }
     };
     
+    class NativeNumaEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setNumaAwarePlacement(true);
+            return env;
+        }
+    };
+    
     class GmmxxEnvironment {
     public:
         typedef double ValueType;
@@ -45,6 +57,7 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
+            NativeNumaEnvironment,
             GmmxxEnvironment
     > TestingTypes;
     
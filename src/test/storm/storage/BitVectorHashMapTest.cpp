@@ -1,6 +1,7 @@
 #include "test/storm_gtest.h"
 
 #include <cstdint>
+#include <vector>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
@@ -67,3 +68,57 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, GetBucket) {
+    storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
+
+    std::vector<storm::storage::BitVector> keys;
+    for (uint64_t index = 0; index < 20; ++index) {
+        storm::storage::BitVector key(64);
+        key.set(index);
+        key.set(63 - index / 2);
+        keys.push_back(key);
+        uint64_t bucket = map.findOrAddAndGetBucket(key, index).second;
+        EXPECT_EQ(bucket, map.getBucket(key));
+    }
+
+    // The buckets change when the map grows, but still hold the keys
+    for (uint64_t index = 0; index < keys.size(); ++index) {
+        auto keyAndValue = map.getBucketAndValue(map.getBucket(keys[index]));
+        EXPECT_EQ(keys[index], keyAndValue.first);
+        EXPECT_EQ(index, keyAndValue.second);
+    }
+}
+
+TEST(BitVectorHashMapTest, BucketRemapping) {
+    storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
+
+    std::vector<storm::storage::BitVector> keys;
+    std::vector<uint64_t> buckets;
+    std::vector<uint64_t> bucketRemapping;
+    uint64_t numberOfResizes = 0;
+    for (uint64_t index = 0; index < 40; ++index) {
+        storm::storage::BitVector key(64);
+        key.set(index);
+        key.set(63 - index / 2);
+        keys.push_back(key);
+        uint64_t capacity = map.capacity();
+        uint64_t bucket = map.findOrAddAndGetBucket(key, index, bucketRemapping).second;
+        if (map.capacity() != capacity) {
+            ++numberOfResizes;
+            ASSERT_EQ(capacity, bucketRemapping.size());
+            // Update the previously known buckets
+            for (auto& previousBucket : buckets) {
+                previousBucket = bucketRemapping[previousBucket];
+            }
+        } else {
+            EXPECT_TRUE(bucketRemapping.empty());
+        }
+        buckets.push_back(bucket);
+
+        for (uint64_t previous = 0; previous < keys.size(); ++previous) {
+            EXPECT_EQ(map.getBucket(keys[previous]), buckets[previous]) << "Key " << previous << " after inserting key " << index;
+        }
+    }
+    EXPECT_LT(0ul, numberOfResizes);
+}
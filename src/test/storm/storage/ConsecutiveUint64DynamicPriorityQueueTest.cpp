@@ -0,0 +1,49 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+
+#include "storm/storage/ConsecutiveUint64DynamicPriorityQueue.h"
+
+TEST(ConsecutiveUint64DynamicPriorityQueueTest, PopPushContains) {
+    std::vector<uint64_t> priorities = {3, 1, 4, 1, 5};
+    auto compare = [&priorities] (uint64_t const& a, uint64_t const& b) { return priorities[a] < priorities[b]; };
+    storm::storage::ConsecutiveUint64DynamicPriorityQueue<decltype(compare)> queue(priorities.size(), compare);
+    EXPECT_EQ(5ul, queue.size());
+    
+    EXPECT_EQ(4ul, queue.popTop());
+    EXPECT_EQ(2ul, queue.popTop());
+    EXPECT_FALSE(queue.contains(4));
+    EXPECT_FALSE(queue.contains(2));
+    EXPECT_TRUE(queue.contains(0));
+    
+    // Re-inserting the first popped element must not make the second one appear to be contained.
+    queue.push(4);
+    EXPECT_TRUE(queue.contains(4));
+    EXPECT_FALSE(queue.contains(2));
+    EXPECT_EQ(4ul, queue.size());
+    
+    // Increasing the priority of an element that is not contained does not affect the queue.
+    priorities[2] = 10;
+    queue.increase(2);
+    EXPECT_FALSE(queue.contains(2));
+    EXPECT_EQ(4ul, queue.top());
+    
+    // Re-inserted elements are ordered by their updated priority.
+    queue.push(2);
+    EXPECT_EQ(5ul, queue.size());
+    priorities[1] = 20;
+    queue.increase(1);
+    EXPECT_EQ(1ul, queue.popTop());
+    EXPECT_EQ(2ul, queue.popTop());
+    EXPECT_EQ(4ul, queue.popTop());
+    EXPECT_EQ(0ul, queue.popTop());
+    EXPECT_EQ(3ul, queue.popTop());
+    EXPECT_TRUE(queue.empty());
+    for (uint64_t element = 0; element < priorities.size(); ++element) {
+        EXPECT_FALSE(queue.contains(element));
+    }
+    
+    queue.push(3);
+    EXPECT_TRUE(queue.contains(3));
+    EXPECT_FALSE(queue.contains(0));
+}
@@ -1,6 +1,7 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/OutOfMemoryException.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
@@ -515,6 +516,33 @@ TEST(CuddDd, OperatorTest) {
     EXPECT_FALSE(dd1.equalModuloPrecision(dd2, 1e-6));
 }
 
+TEST(CuddDd, SumProductTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    std::vector<storm::dd::Add<storm::dd::DdType::CUDD, double>> adds;
+    storm::dd::Add<storm::dd::DdType::CUDD, double> expectedSum = manager->template getAddZero<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> expectedProduct = manager->template getAddOne<double>();
+    for (int_fast64_t value = 1; value <= 9; ++value) {
+        storm::dd::Add<storm::dd::DdType::CUDD, double> add = manager->getEncoding(x.first, value).template toAdd<double>() * manager->template getConstant<double>(value) + manager->template getAddOne<double>();
+        adds.push_back(add);
+        expectedSum += add;
+        expectedProduct *= add;
+    }
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> sum;
+    ASSERT_NO_THROW(sum = storm::dd::Add<storm::dd::DdType::CUDD, double>::sum(*manager, adds));
+    EXPECT_TRUE(sum == expectedSum);
+    EXPECT_EQ(1ul, sum.getContainedMetaVariables().size());
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> product;
+    ASSERT_NO_THROW(product = storm::dd::Add<storm::dd::DdType::CUDD, double>::product(*manager, adds));
+    EXPECT_TRUE(product == expectedProduct);
+    
+    EXPECT_TRUE(storm::dd::Add<storm::dd::DdType::CUDD, double>::sum(*manager, {}) == manager->template getAddZero<double>());
+    EXPECT_TRUE(storm::dd::Add<storm::dd::DdType::CUDD, double>::product(*manager, {}) == manager->template getAddOne<double>());
+}
+
 TEST(CuddDd, AbstractionTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -778,3 +806,22 @@ TEST(CuddDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, StatisticsAndMemoryBudgetTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    storm::dd::Add<storm::dd::DdType::CUDD, double> identity = manager->getIdentity<double>(x.first);
+    
+    storm::dd::DdManagerStatistics statistics = manager->getStatistics();
+    EXPECT_LT(0ul, statistics.liveNodes);
+    EXPECT_LE(statistics.liveNodes, statistics.tableSize);
+    EXPECT_LT(0ul, statistics.memoryInUse);
+    
+    EXPECT_FALSE(static_cast<bool>(manager->getMemoryBudget()));
+    EXPECT_FALSE(manager->isMemoryBudgetExceeded());
+    EXPECT_NO_THROW(manager->checkMemoryBudget("testing"));
+    
+    manager->setMemoryBudget(1ul);
+    EXPECT_TRUE(manager->isMemoryBudgetExceeded());
+    STORM_SILENT_EXPECT_THROW(manager->checkMemoryBudget("testing"), storm::exceptions::OutOfMemoryException);
+}
@@ -792,3 +792,42 @@ TEST(SparseMatrix, Permute) {
     EXPECT_EQ(matrix.getRowSum(3), matrixperm.getRowSum(3));
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
+
+TEST(SparseMatrix, RowGroupColoring) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 4);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 1, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 3, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 2, 0.4));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.4));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    std::vector<std::vector<uint_fast64_t>> coloring = matrix.computeRowGroupColoring();
+    std::vector<uint_fast64_t> groupToColor(matrix.getRowGroupCount(), coloring.size());
+    for (uint_fast64_t color = 0; color < coloring.size(); ++color) {
+        for (auto const& group : coloring[color]) {
+            EXPECT_EQ(coloring.size(), groupToColor[group]);
+            groupToColor[group] = color;
+        }
+    }
+    
+    // Every group is coloured and no group refers to a different group of the same colour.
+    for (uint_fast64_t group = 0; group < matrix.getRowGroupCount(); ++group) {
+        ASSERT_LT(groupToColor[group], coloring.size());
+        for (auto const& entry : matrix.getRowGroup(group)) {
+            if (entry.getColumn() != group) {
+                EXPECT_NE(groupToColor[group], groupToColor[entry.getColumn()]);
+            }
+        }
+    }
+}
+